@@ -2,8 +2,8 @@
 
 #define ll long long
 
-FIFO::FIFO(ll cacheSize, ll blockSize, ll setAssociativity, int level) :
-    Cache(cacheSize, blockSize, setAssociativity, level, "FIFO"){
+FIFO::FIFO(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) :
+    Cache(cacheSize, blockSize, setAssociativity, level, "FIFO", allocateTags){
     fifoBlockInSet = (ll*) malloc(numberOfSets*sizeof(ll));
     memset(fifoBlockInSet, 0, numberOfSets*sizeof(ll));
 }
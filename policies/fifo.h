@@ -7,7 +7,7 @@ class FIFO : public Cache{
         long long *fifoBlockInSet; // each element varies from [0, setAssociativity-1]
 
     public:
-        FIFO(long long cacheSize, long long blockSize, long long setAssociativity, int level);
+        FIFO(long long cacheSize, long long blockSize, long long setAssociativity, int level, bool allocateTags = true);
         long long getBlockToReplace(long long address) override;
         void update(long long blockToReplace, int status) override;
 
@@ -1,20 +1,21 @@
 #include "lfu.h"
+#include <stdexcept>
 
 #define ll long long
 
-LFU::LFU(ll cacheSize, ll blockSize, ll setAssociativity, int level) :
-    Cache(cacheSize, blockSize, setAssociativity, level, "LFU"){
+LFU::LFU(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) :
+    Cache(cacheSize, blockSize, setAssociativity, level, "LFU", allocateTags){
         timesUsed = (ll *)calloc(numberOfSets * (setAssociativity), sizeof(ll));
         if(timesUsed == NULL){
-            printf("Failed to allocate memory for data members of LFU (L%d) cache\n", level);
-            exit(0);
+            throw std::runtime_error("Failed to allocate memory for data members of LFU (L" + std::to_string(level) + ") cache");
         }
     }
 
 ll LFU::getBlockToReplace(ll address){
-    int index = getIndex(address);
-    int min_block = index*setAssociativity;
-    for(int block = index*setAssociativity; block < (index+1)*setAssociativity; block++) {
+    ll index = getIndex(address);
+    ll min_block = getWayBlock(address, index, 0);
+    for(ll way = 0; way < setAssociativity; way++) {
+        ll block = getWayBlock(address, index, way);
         if(timesUsed[block] == 0) // an empty slot
             return block;
         if(timesUsed[block] < timesUsed[min_block]) {
@@ -33,6 +34,10 @@ void LFU::update(ll block, int status){
     }
 }
 
+bool LFU::supportsSkew(){
+    return true;
+}
+
 LFU::~LFU(){
     free(timesUsed);
 }
\ No newline at end of file
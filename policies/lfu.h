@@ -7,9 +7,10 @@ class LFU : public Cache{
         long long *timesUsed;
 
     public:
-        LFU(long long cacheSize, long long blockSize, long long setAssociativity, int level);
+        LFU(long long cacheSize, long long blockSize, long long setAssociativity, int level, bool allocateTags = true);
         long long getBlockToReplace(long long address) override;
         void update(long long blockToReplace, int status) override;
+        bool supportsSkew() override;
 
         ~LFU();
 };
\ No newline at end of file
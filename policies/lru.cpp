@@ -1,20 +1,21 @@
 #include "lru.h"
+#include <stdexcept>
 
 #define ll long long
 
-LRU::LRU(ll cacheSize, ll blockSize, ll setAssociativity, int level) : 
-    Cache(cacheSize, blockSize, setAssociativity, level, "LRU "){
+LRU::LRU(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) : 
+    Cache(cacheSize, blockSize, setAssociativity, level, "LRU ", allocateTags){
         lastUsed = (ll *)calloc(numberOfSets * (setAssociativity), sizeof(ll));
         if(lastUsed == NULL){
-            printf("Failed to allocate memory for data members of LRU (L%d) cache\n", level);
-            exit(0);
+            throw std::runtime_error("Failed to allocate memory for data members of LRU (L" + std::to_string(level) + ") cache");
         }
     }
 
 ll LRU::getBlockToReplace(ll address){
-    int index = getIndex(address);
-    int min_block = index*setAssociativity;
-    for(int block = index*setAssociativity; block < (index+1)*setAssociativity; block++) {
+    ll index = getIndex(address);
+    ll min_block = getWayBlock(address, index, 0);
+    for(ll way = 0; way < setAssociativity; way++) {
+        ll block = getWayBlock(address, index, way);
         if(lastUsed[block] == 0) // an empty slot
             return block;
         if(lastUsed[block] < lastUsed[min_block]) {
@@ -25,10 +26,15 @@ ll LRU::getBlockToReplace(ll address){
 }
 
 void LRU::update(ll block, int status){
+    (void)status;
     lastUsed[block] = time;
     time++;
 }
 
+bool LRU::supportsSkew(){
+    return true;
+}
+
 LRU::~LRU(){
     free(lastUsed);
 }
@@ -7,9 +7,10 @@ class LRU : public Cache{
         long long time;
         long long *lastUsed;
     public:
-        LRU(long long cacheSize, long long blockSize, long long setAssociativity, int level);
+        LRU(long long cacheSize, long long blockSize, long long setAssociativity, int level, bool allocateTags = true);
         long long getBlockToReplace(long long address) override;
         void update(long long blockToReplace, int status) override;
+        bool supportsSkew() override;
 
         ~LRU();
 };
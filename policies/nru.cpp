@@ -2,8 +2,8 @@
 
 #define ll long long
 
-NRU::NRU(ll cacheSize, ll blockSize, ll setAssociativity, int level) :
-    Cache(cacheSize, blockSize, setAssociativity, level, "NRU"){
+NRU::NRU(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) :
+    Cache(cacheSize, blockSize, setAssociativity, level, "NRU", allocateTags){
         recentlyUsed = (bool*) calloc(setAssociativity * numberOfSets, sizeof(bool));
         nRecentlyUsed = (ll*) calloc(numberOfSets, sizeof(ll));
     }
@@ -15,9 +15,12 @@ ll NRU::getBlockToReplace(ll address){
             return block;
         }
     }
+    // direct-mapped 이면 하나뿐인 블록이 방금 쓰인 상태로 남음
+    return index * setAssociativity;
 }
 
 void NRU::update(ll block, int status){
+    (void)status;
     if(recentlyUsed[block] != true){
         recentlyUsed[block] = true;
         nRecentlyUsed[block/setAssociativity]++;
@@ -8,7 +8,7 @@ class NRU : public Cache{
         long long* nRecentlyUsed;
 
     public:
-        NRU(long long cacheSize, long long blockSize, long long setAssociativity, int level);
+        NRU(long long cacheSize, long long blockSize, long long setAssociativity, int level, bool allocateTags = true);
         long long getBlockToReplace(long long address) override;
         void update(long long blockToReplace, int status) override;
 
@@ -1,4 +1,5 @@
 #include "plru.h"
+#include <stdexcept>
 
 #define ll long long
 
@@ -19,12 +20,11 @@
         
     for an 8-way setAssociativity
     */
-    PLRU::PLRU(ll cacheSize, ll blockSize, ll setAssociativity, int level) : 
-        Cache(cacheSize, blockSize, setAssociativity, level, "PLRU"){
+    PLRU::PLRU(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) : 
+        Cache(cacheSize, blockSize, setAssociativity, level, "PLRU", allocateTags){
             tree = (bool *)calloc(numberOfSets * (setAssociativity - 1), sizeof(bool));
             if(tree == NULL){
-                printf("Failed to allocate memory for data members of PLRU (L%d) cache\n", level);
-                exit(0);            
+                throw std::runtime_error("Failed to allocate memory for data members of PLRU (L" + std::to_string(level) + ") cache");
             }
         }
 
@@ -44,6 +44,7 @@
     }
 
     void PLRU::update(ll block, int status){
+        (void)status;
         ll node = (block % setAssociativity) + setAssociativity;
         ll setNumber = block / setAssociativity;
         while(node>1){
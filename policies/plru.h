@@ -7,7 +7,7 @@ class PLRU : public Cache{
         bool* tree;
 
     public:
-        PLRU(long long cacheSize, long long blockSize, long long setAssociativity, int level);
+        PLRU(long long cacheSize, long long blockSize, long long setAssociativity, int level, bool allocateTags = true);
         long long getBlockToReplace(long long address) override;
         void update(long long blockToReplace, int status) override;
 
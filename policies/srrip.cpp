@@ -1,4 +1,5 @@
 #include "srrip.h"
+#include <stdexcept>
 
 #define ll long long
 
@@ -23,12 +24,11 @@
 
 */
 
-SRRIP::SRRIP(ll cacheSize, ll blockSize, ll setAssociativity, int level) : 
-    Cache(cacheSize, blockSize, setAssociativity, level, "SRRIP"){
+SRRIP::SRRIP(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) : 
+    Cache(cacheSize, blockSize, setAssociativity, level, "SRRIP", allocateTags){
         state = (int *)calloc(numberOfSets * (setAssociativity), sizeof(int));
         if(state == NULL){
-            printf("Failed to allocate memory for data members of LRU (L%d) cache\n", level);
-            exit(0);
+            throw std::runtime_error("Failed to allocate memory for data members of SRRIP (L" + std::to_string(level) + ") cache");
         } else {
             for(ll i=0;i<numberOfSets*(setAssociativity);i++)
                 state[i] = -1;
@@ -45,27 +45,26 @@ ll SRRIP::getBlockToReplace(ll address){
     // Step 5: replace block and set state value to 2 for the new block
 
 
-    int index = getIndex(address);
-    ll block_begin = index*setAssociativity;
-    ll block_end = (index+1)*setAssociativity;
+    ll index = getIndex(address);
 
     //check if empty slot is available
-    for(ll block = block_begin; block < block_end; block++)
-        if(state[block]==-1)
-            return block;
+    for(ll way = 0; way < setAssociativity; way++)
+        if(state[getWayBlock(address, index, way)]==-1)
+            return getWayBlock(address, index, way);
 
     //if none found, search for block with state 3
     while(true){
         //Step 1
-        for(ll block=block_begin; block < block_end; block++){
+        for(ll way = 0; way < setAssociativity; way++){
             //if state is 3, Step 5
+            ll block = getWayBlock(address, index, way);
             if(state[block]==3)
                 return block;
         }
 
         //state 3 not found, Step 3
-        for(ll i=block_begin; i < block_end; i++){
-            state[i]++;
+        for(ll way = 0; way < setAssociativity; way++){
+            state[getWayBlock(address, index, way)]++;
         }
     }
 }
@@ -74,6 +73,10 @@ void SRRIP::update(ll block, int status){
     state[block] = (status == 1) ? 0 : 2;
 }
 
+bool SRRIP::supportsSkew(){
+    return true;
+}
+
 SRRIP::~SRRIP(){
     free(state);
 }
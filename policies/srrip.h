@@ -7,9 +7,10 @@ class SRRIP : public Cache{
         int *state;
 
     public:
-        SRRIP(long long cacheSize, long long blockSize, long long setAssociativity, int level);
+        SRRIP(long long cacheSize, long long blockSize, long long setAssociativity, int level, bool allocateTags = true);
         long long getBlockToReplace(long long address) override;
         void update(long long blockToReplace, int status) override;
+        bool supportsSkew() override;
 
         ~SRRIP();
 };
\ No newline at end of file
@@ -1,15 +1,15 @@
-#include "UpgradedLRU.h"
+#include "upgradedLRU.h"
 #include <iostream>
 #include <cstdlib>
+#include <stdexcept>
 
 UpgradedLRU::UpgradedLRU(ll cacheSize, ll blockSize, ll setAssociativity, int level, size_t sectorSize)
     : Cache(cacheSize, blockSize, setAssociativity, level, "UpgradedLRU"), sectorSize(sectorSize) {
     numSectors = blockSize / sectorSize; // 블록당 섹터 개수 계산
-    cache.resize(numberOfSets * setAssociativity, CacheLine(numSectors, sectorSize)); // 섹터화된 캐시 구조 생성
+    cache.resize(numberOfSets * setAssociativity, CacheLine(numSectors)); // 섹터화된 캐시 구조 생성
     lastUsed = (ll*)calloc(numberOfSets * setAssociativity * numSectors, sizeof(ll)); // 섹터별 LRU 관리용 배열 초기화
     if (lastUsed == NULL) {
-        std::cerr << "Failed to allocate memory for LRU tracking in UpgradedLRU cache\n";
-        exit(EXIT_FAILURE);
+        throw std::runtime_error("Failed to allocate memory for LRU tracking in UpgradedLRU cache");
     }
 }
 
@@ -79,10 +79,10 @@ void UpgradedLRU::insert(Access access, ll blockToReplace) {
 
         if(isInWriteBuffer(blockAddress)) writeBuffer[blockAddress] = cache[blockToReplace].sectors[sector].tag;
         else writeBuffer.insert({blockAddress, cache[blockToReplace].sectors[sector].tag});
-        #ifdef DEBUG
-        std::cout << "Evicted dirty sector from block " << blockToReplace 
+        if(debug){
+            std::cout << "Evicted dirty sector from block " << blockToReplace 
                       << " and added to Write Buffer.\n";
-        #endif
+        }
              
         // 기존 블록 evict
         evict(blockToReplace);
@@ -103,11 +103,16 @@ void UpgradedLRU::insert(Access access, ll blockToReplace) {
     if (access.accessType == 's') cache[blockToReplace].sectors[sector].dirty = true;
 }
 
+bool UpgradedLRU::supportsShadow(){
+    return false;
+}
+
 bool UpgradedLRU::isInWriteBuffer(ll address){
     return (writeBuffer.find(address) != writeBuffer.end());
 }
 
 void UpgradedLRU::update(ll block, int status) {
+    (void)status;
     if(writeBuffer.size() > 19) flushWriteBuffer();
     ll baseIndex = block * numSectors;
     for (size_t sectorIdx = 0; sectorIdx < numSectors; sectorIdx++) {
@@ -122,10 +127,10 @@ void UpgradedLRU::update(ll block, int status) {
 void UpgradedLRU::flushWriteBuffer() {
     // write buffer에 저장된 것들을 모두 메모리에 저장함. 이 때 저장된 수에 따라? 주소에 따라? 메모리 접근 횟수를 추가시켜야함.
     incMemAccs(writeBuffer.size());
+    if(debug){
+        std::cout << "Flushed " << writeBuffer.size() << " entries from the write buffer\n";
+    }
     writeBuffer.clear();
-    #if DEBUG
-    std::cout << "Flushed address: " << address << " with data size: " << data.size() << "\n";
-    #endif
 }
 
 void UpgradedLRU::evict(ll block) {
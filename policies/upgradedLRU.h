@@ -12,7 +12,8 @@ public:
     void update(ll block, int status) override; // LRU 상태 업데이트
     ll getBlockPosition(ll address) override; // 블록 위치 확인 (캐시 히트 검사)
     void insert(ll address, ll blockToReplace) override; // 블록 삽입
-    void insert(Access access, ll blockToReplace); // 블록 삽입
+    void insert(Access access, ll blockToReplace) override; // 블록 삽입 (쓰기면 dirty)
+    bool supportsShadow() override; // 섹터화된 자체 태그를 쓰므로 false
     void flushWriteBuffer(); // Write Buffer 플러시
     bool isInWriteBuffer(ll);
     ~UpgradedLRU();
@@ -24,13 +25,13 @@ private:
         ll tag; // 섹터 데이터
         ll address;
 
-        Sector(size_t sector_size) : valid(false), dirty(false), tag(-1), address(-1) {}
+        Sector() : valid(false), dirty(false), tag(-1), address(-1) {}
     };
 
     struct CacheLine {
         std::vector<Sector> sectors; // 섹터 배열
-        CacheLine(size_t num_sectors, size_t sector_size)
-            : sectors(num_sectors, Sector(sector_size)) {}
+        CacheLine(size_t num_sectors)
+            : sectors(num_sectors, Sector()) {}
     };
 
     size_t sectorSize;     // 섹터 크기
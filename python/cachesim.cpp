@@ -0,0 +1,311 @@
+// cachesim 파이썬 모듈 (Boost.Python)
+// NumPy 배열은 버퍼 프로토콜로 복사하지 않고 그대로 읽고, 시뮬레이션하는 동안 GIL을 놓아
+// 여러 스레드/프로세스에서 동시에 돌릴 수 있음.
+#include <boost/python.hpp>
+#include <memory>
+#include <stdexcept>
+#include <stdint.h>
+#include <string.h>
+#include "hierarchy.h"
+#include "../policies/plru.h"
+#include "../policies/lru.h"
+#include "../policies/srrip.h"
+#include "../policies/nru.h"
+#include "../policies/lfu.h"
+#include "../policies/fifo.h"
+#include "../policies/upgradedLRU.h"
+
+namespace bp = boost::python;
+
+#define ll long long
+
+// 1차원 연속 배열을 복사 없이 빌림 (formats 중 하나의 형식, itemSize 바이트 원소)
+class Buffer{
+
+    private:
+        Py_buffer view;
+
+    public:
+        Buffer(bp::object array, const char* formats, ssize_t itemSize, const char* error){
+            if(PyObject_GetBuffer(array.ptr(), &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0){
+                PyErr_Clear();
+                throw std::invalid_argument(error);
+            }
+            const char* format = view.format;
+            if(format[0] == '@' || format[0] == '=' || format[0] == '<') format++;
+            if(view.ndim != 1 || view.itemsize != itemSize || format[0] == '\0' || format[1] != '\0'
+                || strchr(formats, format[0]) == NULL){
+                PyBuffer_Release(&view);
+                throw std::invalid_argument(error);
+            }
+        }
+
+        const void* data(){
+            return view.buf;
+        }
+
+        ssize_t size(){
+            return view.shape[0];
+        }
+
+        ~Buffer(){
+            PyBuffer_Release(&view);
+        }
+};
+
+// 시뮬레이션하는 동안 GIL을 놓음
+class ReleaseGIL{
+
+    private:
+        PyThreadState* state;
+
+    public:
+        ReleaseGIL(){
+            state = PyEval_SaveThread();
+        }
+
+        ~ReleaseGIL(){
+            PyEval_RestoreThread(state);
+        }
+};
+
+#define ADDRESS_ERROR "addresses must be a contiguous 1-D int64 array"
+#define WRITES_ERROR "writes must be a contiguous 1-D bool/uint8 array with one entry per address"
+
+// 단일 캐시에 접근 (Hierarchy::access 의 한 레벨과 같은 순서)
+static bool cacheAccess(Cache& cache, ll address){
+    ll block = cache.getBlockPosition(address);
+    if(block == -1){
+        cache.incMisses();
+        block = cache.getBlockToReplace(address);
+        cache.insert(address, block);
+        cache.update(block, 0);
+        return false;
+    }
+    cache.incHits();
+    cache.update(block, 1);
+    return true;
+}
+
+static ll cacheReplay(Cache& cache, bp::object addresses){
+    Buffer buffer(addresses, "lq", 8, ADDRESS_ERROR);
+    const int64_t* data = static_cast<const int64_t*>(buffer.data());
+    ssize_t count = buffer.size();
+    ll hits = 0;
+    {
+        ReleaseGIL release;
+        for(ssize_t i = 0; i < count; i++){
+            hits += cacheAccess(cache, data[i]);
+        }
+    }
+    return hits;
+}
+
+static void setIndexFunction(Cache& cache, const std::string& name){
+    IndexFunction function;
+    if(!parseIndexFunction(name, function)){
+        throw std::invalid_argument("unknown index function: " + name);
+    }
+    cache.setIndexFunction(function);
+}
+
+static void checkLevel(Hierarchy& hierarchy, int level){
+    if(level < 0 || level >= hierarchy.getLevels()){
+        throw std::out_of_range("level " + std::to_string(level) + " out of range (hierarchy has "
+            + std::to_string(hierarchy.getLevels()) + " levels)");
+    }
+}
+
+static Cache* hierarchyCache(Hierarchy& hierarchy, int level){
+    checkLevel(hierarchy, level);
+    return hierarchy.getCache(level);
+}
+
+static bp::dict levelStats(Hierarchy& hierarchy, int level){
+    checkLevel(hierarchy, level);
+    Cache* cache = hierarchy.getCache(level);
+    bp::dict stats;
+    stats["level"] = cache->getLevel();
+    stats["policy"] = cache->getPolicy();
+    stats["hits"] = cache->getHits();
+    stats["misses"] = cache->getMisses();
+    stats["hit_rate"] = cache->getHitRate();
+    stats["mem_accesses"] = cache->getMemAccs();
+    if(VictimCache* victim = hierarchy.getVictimCache(level)){
+        stats["victim_hits"] = victim->getHits();
+        stats["victim_misses"] = victim->getMisses();
+    }
+    if(MSHR* mshr = hierarchy.getMSHR(level)){
+        stats["mshr_delayed_hits"] = mshr->getDelayedHits();
+        stats["mshr_stalls"] = mshr->getStalls();
+    }
+    if(NUCACache* nuca = dynamic_cast<NUCACache*>(cache)){
+        stats["nuca_load_imbalance"] = nuca->getLoadImbalance();
+        stats["nuca_average_latency"] = nuca->getAverageLatency();
+    }
+    return stats;
+}
+
+static bp::list hierarchyStats(Hierarchy& hierarchy){
+    bp::list levels;
+    for(int level = 0; level < hierarchy.getLevels(); level++){
+        levels.append(levelStats(hierarchy, level));
+    }
+    return levels;
+}
+
+static int hierarchyAccess(Hierarchy& hierarchy, ll address, bool write){
+    return hierarchy.access({write ? 's' : 'l', address});
+}
+
+static ll hierarchyReplay(Hierarchy& hierarchy, bp::object addresses, bp::object writes){
+    Buffer buffer(addresses, "lq", 8, ADDRESS_ERROR);
+    const int64_t* data = static_cast<const int64_t*>(buffer.data());
+    ssize_t count = buffer.size();
+    const uint8_t* flags = NULL;
+    std::unique_ptr<Buffer> flagBuffer;
+    if(!writes.is_none()){
+        flagBuffer.reset(new Buffer(writes, "?Bb", 1, WRITES_ERROR));
+        if(flagBuffer->size() != count){
+            throw std::invalid_argument(WRITES_ERROR);
+        }
+        flags = static_cast<const uint8_t*>(flagBuffer->data());
+    }
+    int levels = hierarchy.getLevels();
+    ll memoryAccesses = 0;
+    {
+        ReleaseGIL release;
+        for(ssize_t i = 0; i < count; i++){
+            Access access = {(flags != NULL && flags[i]) ? 's' : 'l', (ll)data[i]};
+            memoryAccesses += hierarchy.access(access) == levels;
+        }
+    }
+    return memoryAccesses;
+}
+
+// Hierarchy(levels): LevelConfig 목록 또는 params.cfg 형식 파일의 경로
+static Hierarchy* makeHierarchy(bp::object levels){
+    bp::extract<std::string> path(levels);
+    if(path.check()){
+        return new Hierarchy(path().c_str());
+    }
+    std::vector<LevelConfig> config;
+    for(ssize_t i = 0; i < bp::len(levels); i++){
+        config.push_back(bp::extract<LevelConfig>(levels[i]));
+    }
+    return new Hierarchy(config);
+}
+
+static LevelConfig* makeLevelConfig(const std::string& line){
+    return new LevelConfig(parseLevel(line, 1));
+}
+
+static bp::dict getOptions(const LevelConfig& config){
+    bp::dict options;
+    for(std::map<std::string, std::string>::const_iterator it = config.options.begin(); it != config.options.end(); it++){
+        options[it->first] = it->second;
+    }
+    return options;
+}
+
+static void setOptions(LevelConfig& config, bp::dict options){
+    std::map<std::string, std::string> values;
+    bp::list keys = options.keys();
+    for(ssize_t i = 0; i < bp::len(keys); i++){
+        std::string key = bp::extract<std::string>(keys[i]);
+        values[key] = bp::extract<std::string>(options[keys[i]]);
+    }
+    config.options = values;
+}
+
+static std::string describeLevelConfig(const LevelConfig& config){
+    return "LevelConfig('" + describeLevel(config) + "')";
+}
+
+static bp::list readConfigFile(const std::string& path){
+    std::vector<LevelConfig> config = readConfig(path.c_str());
+    bp::list levels;
+    for(size_t i = 0; i < config.size(); i++){
+        levels.append(config[i]);
+    }
+    return levels;
+}
+
+static void translateInvalidArgument(const std::invalid_argument& error){
+    PyErr_SetString(PyExc_ValueError, error.what());
+}
+
+static void translateOutOfRange(const std::out_of_range& error){
+    PyErr_SetString(PyExc_IndexError, error.what());
+}
+
+// 정책 생성자는 level 기본값이 없어서 팩토리로 감쌈
+template <class Policy>
+static Policy* makePolicy(ll cacheSize, ll blockSize, ll setAssociativity, int level){
+    return new Policy(cacheSize, blockSize, setAssociativity, level);
+}
+
+static UpgradedLRU* makeUpgradedLRU(ll cacheSize, ll blockSize, ll setAssociativity, int level, size_t sectorSize){
+    return new UpgradedLRU(cacheSize, blockSize, setAssociativity, level, sectorSize);
+}
+
+template <class Policy>
+static void bindPolicy(const char* name){
+    bp::class_<Policy, bp::bases<Cache>, boost::noncopyable>(name, bp::no_init)
+        .def("__init__", bp::make_constructor(&makePolicy<Policy>, bp::default_call_policies(),
+            (bp::arg("cache_size"), bp::arg("block_size"), bp::arg("associativity"), bp::arg("level") = 1)));
+}
+
+BOOST_PYTHON_MODULE(cachesim){
+    bp::scope().attr("__doc__") = "Multi-level cache simulator";
+    bp::register_exception_translator<std::invalid_argument>(&translateInvalidArgument);
+    bp::register_exception_translator<std::out_of_range>(&translateOutOfRange);
+
+    bp::class_<LevelConfig>("LevelConfig", bp::no_init)
+        .def("__init__", bp::make_constructor(&makeLevelConfig, bp::default_call_policies(), (bp::arg("line"))))
+        .def_readwrite("policy", &LevelConfig::policy)
+        .def_readwrite("cache_size", &LevelConfig::cacheSize)
+        .def_readwrite("block_size", &LevelConfig::blockSize)
+        .def_readwrite("associativity", &LevelConfig::setAssociativity)
+        .add_property("options", &getOptions, &setOptions)
+        .def("__repr__", &describeLevelConfig);
+
+    bp::def("read_config", &readConfigFile, (bp::arg("path")));
+
+    bp::class_<Cache, boost::noncopyable>("Cache", bp::no_init)
+        .add_property("level", &Cache::getLevel)
+        .add_property("policy", &Cache::getPolicy)
+        .add_property("sets", &Cache::getNumberOfSets)
+        .add_property("associativity", &Cache::getSetAssociativity)
+        .add_property("hits", &Cache::getHits)
+        .add_property("misses", &Cache::getMisses)
+        .add_property("hit_rate", &Cache::getHitRate)
+        .add_property("mem_accesses", &Cache::getMemAccs)
+        .def("set_index_function", &setIndexFunction, (bp::arg("name")))
+        .def("access", &cacheAccess, (bp::arg("address")), "Look up and fill one address; returns True on a hit")
+        .def("replay", &cacheReplay, (bp::arg("addresses")), "Replay an int64 address array; returns the number of hits");
+
+    bindPolicy<PLRU>("PLRU");
+    bindPolicy<LRU>("LRU");
+    bindPolicy<SRRIP>("SRRIP");
+    bindPolicy<NRU>("NRU");
+    bindPolicy<LFU>("LFU");
+    bindPolicy<FIFO>("FIFO");
+    bp::class_<UpgradedLRU, bp::bases<Cache>, boost::noncopyable>("UpgradedLRU", bp::no_init)
+        .def("__init__", bp::make_constructor(&makeUpgradedLRU, bp::default_call_policies(),
+            (bp::arg("cache_size"), bp::arg("block_size"), bp::arg("associativity"), bp::arg("level") = 1,
+                bp::arg("sector_size") = 16)));
+
+    bp::class_<Hierarchy, boost::noncopyable>("Hierarchy", bp::no_init)
+        .def("__init__", bp::make_constructor(&makeHierarchy, bp::default_call_policies(), (bp::arg("levels"))))
+        .add_property("levels", &Hierarchy::getLevels)
+        .add_property("reads", &Hierarchy::getReads)
+        .add_property("writes", &Hierarchy::getWrites)
+        .def("cache", &hierarchyCache, (bp::arg("level")), bp::return_internal_reference<>())
+        .def("access", &hierarchyAccess, (bp::arg("address"), bp::arg("write") = false),
+            "Simulate one access; returns the level that hit (levels if it missed everywhere)")
+        .def("replay", &hierarchyReplay, (bp::arg("addresses"), bp::arg("writes") = bp::object()),
+            "Replay int64 addresses (and optional uint8/bool write flags) without copying; "
+            "returns the number of accesses that missed in every level")
+        .def("stats", &hierarchyStats);
+}
@@ -0,0 +1,75 @@
+# cachesim 모듈 스모크 테스트: make python-test (make python 으로 만든 모듈을 저장소 루트에서 읽음)
+import os
+import sys
+import unittest
+
+import numpy as np
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+import cachesim  # noqa: E402
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+
+class SmokeTest(unittest.TestCase):
+
+    def test_replay(self):
+        h = cachesim.Hierarchy([cachesim.LevelConfig("lru 32768 64 8"),
+                                cachesim.LevelConfig("srrip 1048576 64 16 index=xor")])
+        addresses = np.arange(0, 64 * 4096, 64, dtype=np.int64)
+        missed = h.replay(addresses, writes=addresses % 3 == 0)
+        stats = h.stats()
+        self.assertEqual(len(stats), 2)
+        self.assertEqual(stats[0]["hits"] + stats[0]["misses"], len(addresses))
+        self.assertEqual(missed, stats[1]["misses"])
+        self.assertEqual(h.reads + h.writes, len(addresses))
+
+        l1 = cachesim.PLRU(32768, 64, 8)
+        self.assertEqual(l1.replay(np.zeros(100, dtype=np.int64)), 99)
+
+    def test_config_file(self):
+        levels = cachesim.read_config(os.path.join(ROOT, "params.cfg"))
+        self.assertGreater(len(levels), 0)
+        self.assertEqual(cachesim.Hierarchy(levels).levels, len(levels))
+
+    # 같은 전체 용량이면 뱅크로 나눠도 균일한 트레이스의 히트율이 거의 같아야 함
+    def test_nuca_banks(self):
+        addresses = np.random.default_rng(1).integers(0, 2 << 20, 1 << 20, dtype=np.int64) & ~63
+        rates = []
+        for banks in ["", " banks=4", " banks=16"]:
+            h = cachesim.Hierarchy([cachesim.LevelConfig("lru 1048576 64 16" + banks)])
+            h.replay(addresses)
+            rates.append(h.stats()[0]["hit_rate"])
+        self.assertGreater(rates[0], 0.4)
+        for rate in rates[1:]:
+            self.assertAlmostEqual(rate, rates[0], delta=0.01)
+
+    # 잘못된 입력은 인터프리터를 끝내지 않고 ValueError 가 됨
+    def test_errors_raise(self):
+        with self.assertRaises(ValueError):
+            cachesim.LevelConfig("bad")
+        with self.assertRaises(ValueError):
+            cachesim.read_config(os.path.join(ROOT, "missing.cfg"))
+        with self.assertRaises(ValueError):
+            cachesim.Hierarchy([cachesim.LevelConfig("bogus 32768 64 8")])
+        with self.assertRaises(ValueError):
+            cachesim.Hierarchy([cachesim.LevelConfig("lru 32768 64 8 index=foo")])
+        with self.assertRaises(ValueError):
+            cachesim.PLRU(32768, 64, 8).set_index_function("skew")
+        with self.assertRaises(ValueError):
+            cachesim.PLRU(0, 64, 8)
+        with self.assertRaises(ValueError):
+            cachesim.LRU(32768, 0, 8)
+        with self.assertRaises(ValueError):
+            cachesim.Hierarchy([cachesim.LevelConfig("lru 32768 64 0")])
+        h = cachesim.Hierarchy([cachesim.LevelConfig("lru 32768 64 8")])
+        with self.assertRaises(IndexError):
+            h.cache(5)
+        with self.assertRaises(IndexError):
+            h.cache(-1)
+        # 예외 뒤에도 모듈을 계속 쓸 수 있음
+        self.assertEqual(cachesim.Hierarchy([cachesim.LevelConfig("lru 32768 64 8")]).levels, 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
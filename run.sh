@@ -2,34 +2,85 @@ BASEDIR=$(dirname $0)
 
 if [ $# -eq 0 ]; then
     echo "Usage:"
-    echo "./run.sh -t|--trace <TRACE> -c|--config <CONFIG_FILE> [-i|--interactive] [-d|--debug]"
+    echo "./run.sh -t|--trace <TRACE>|-g|--generate <SPEC> -c|--config <CONFIG_FILE> [-i|--interactive] [-d|--debug] [-s|--stats [--stats-interval <N>] [--stats-prefix <PREFIX>]] [-p|--profile] [--policy <LEVEL>=<POLICY>] [-f|--filter <MISS_STREAM>] [--reuse <DIR>] [--shadow <POLICY>,<POLICY>...] [--tlb <KEY>=<VALUE>[,...]] [--dram <KEY>=<VALUE>[,...]]"
+    echo "./run.sh --sweep <SPEC> [--results <CSV>] [-j|--jobs <THREADS>]"
+    echo "./run.sh --simpoint -t|--trace <TRACE>|-g|--generate <SPEC> -c|--config <CONFIG_FILE> [--interval <N>] [--clusters <K>] [--warmup <N>] [--policy <LEVEL>=<POLICY>]"
+    echo "./run.sh -a|--analyze -t|--trace <TRACE>|-g|--generate <SPEC> [--window <N>] [--line <BYTES>] [--exact] [--analysis-csv <CSV>]"
 else
     ARGS=""
     TRACE=""
+    GENERATE=""
+    FILTER=""
     CONFIG=""
+    SWEEP=""
+    ANALYZE=""
     while [[ $# -gt 0 ]]; do
         case $1 in
             -i|--interactive)
-                ARGS="$ARGS -DINTERACTIVE -lcurses "
+                ARGS="$ARGS -i"
                 shift
-                if [[ "$ARGS" =~ "-DDEBUG" ]]; then
-                    echo "-i and -d options are not supported together"
-                    exit 1
-                fi
                 ;;
             -d|--debug)
-                ARGS="$ARGS -DDEBUG"
+                ARGS="$ARGS -d"
+                shift
+                ;;
+            -s|--stats)
+                ARGS="$ARGS -s"
+                shift
+                ;;
+            --stats-interval)
+                ARGS="$ARGS --stats-interval $2"
+                shift
+                shift
+                ;;
+            --stats-prefix)
+                ARGS="$ARGS --stats-prefix $2"
+                shift
+                shift
+                ;;
+            -p|--profile)
+                ARGS="$ARGS -p"
+                shift
+                ;;
+            --policy)
+                ARGS="$ARGS --policy $2"
+                shift
+                shift
+                ;;
+            --sweep)
+                SWEEP="$2"
+                shift
+                shift
+                ;;
+            -a|--analyze)
+                ANALYZE="1"
+                ARGS="$ARGS --analyze"
+                shift
+                ;;
+            --exact|--simpoint)
+                ARGS="$ARGS $1"
+                shift
+                ;;
+            --results|-j|--jobs|--window|--line|--analysis-csv|--reuse|--shadow|--interval|--clusters|--warmup|--tlb|--dram)
+                ARGS="$ARGS $1 $2"
+                shift
                 shift
-                if [[ "$ARGS" =~ "-DINTERACTIVE" ]]; then
-                    echo "-i and -d options are not supported together"
-                    exit 1
-                fi
                 ;;
             -t|--trace)
                 TRACE="$2"
                 shift
                 shift
                 ;;
+            -g|--generate)
+                GENERATE="$2"
+                shift
+                shift
+                ;;
+            -f|--filter)
+                FILTER="-f $2"
+                shift
+                shift
+                ;;
             -c|--config)
                 CONFIG="$2"
                 shift
@@ -41,15 +92,18 @@ else
                 ;;
         esac
     done
-    if [ $CONFIG == "" ]; then
+    if [ "$SWEEP" != "" ]; then
+        make -s -C ${BASEDIR} cacheSim
+        ${BASEDIR}/cacheSim --sweep $SWEEP $ARGS
+    elif [ "$CONFIG" == "" ] && [ "$ANALYZE" == "" ]; then
         echo "Please provide a configuration"
-    elif [ $TRACE == "" ]; then
+    elif [ "$GENERATE" != "" ]; then
+        make -s -C ${BASEDIR} cacheSim
+        ${BASEDIR}/cacheSim $CONFIG -g "$GENERATE" $FILTER $ARGS
+    elif [ "$TRACE" == "" ] || [ ! -r "$TRACE" ]; then
         echo "Please provide a proper trace file"
-    elif [ $(file --mime-type -b $TRACE) != "application/gzip" ]; then
-        echo "Please provide a trace in gzip format"
     else
-        make clean
-        make G++FLAGS="$ARGS"
-        gzip -dc $TRACE | ${BASEDIR}/cacheSim $CONFIG
+        make -s -C ${BASEDIR} cacheSim
+        ${BASEDIR}/cacheSim $CONFIG -t "$TRACE" $FILTER $ARGS
     fi
 fi
\ No newline at end of file
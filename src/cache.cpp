@@ -1,9 +1,8 @@
 #include "cache.h"
+#include <stdexcept>
 
 #define ll long long
 
-ll readCounter=0, writeCounter=0;
-
 // helper functions
 
 bool isValidConfig(ll  cs, ll bs, ll sa){ // needs more analysis
@@ -43,20 +42,27 @@ int log2(ll x) {
     return power;
 }
 
-void incReads(){
-    readCounter++;
-}
-
-void incWrites(){
-    writeCounter++;
+bool parseIndexFunction(const std::string& name, IndexFunction& function){
+    if(name == "bits") function = INDEX_BITS;
+    else if(name == "mod") function = INDEX_MODULO;
+    else if(name == "xor") function = INDEX_XOR;
+    else if(name == "prime") function = INDEX_PRIME;
+    else if(name == "skew") function = INDEX_SKEW;
+    else return false;
+    return true;
 }
 
-ll getReads(){
-    return readCounter;
+static bool isPrime(ll x){
+    if(x < 2) return false;
+    for(ll d = 2; d*d <= x; d++){
+        if(x % d == 0) return false;
+    }
+    return true;
 }
 
-ll getWrites(){
-    return writeCounter;
+// skewed 인덱스에서 way별로 쓰는 곱셈 해시 상수 (홀수)
+static inline unsigned long long skewMultiplier(ll way){
+    return (0x9E3779B97F4A7C15ULL + (unsigned long long)way * 0xC2B2AE3D27D4EB4EULL) | 1ULL;
 }
 
 std::string Cache::getPolicy(){
@@ -65,11 +71,17 @@ std::string Cache::getPolicy(){
 
 // Cache class
 
-Cache::Cache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::string policy){
+Cache::Cache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::string policy) :
+    Cache(cacheSize, blockSize, setAssociativity, level, policy, true){
+}
+
+Cache::Cache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::string policy, bool allocateTags){
     
     // 주어진 캐시 구성(cacheSize, blockSize, setAssociativity)이 유효한지 확인
-    if(!isValidConfig(cacheSize, blockSize, setAssociativity)){
-        printf("Invalid Cache configuration\n");
+    if(cacheSize <= 0 || blockSize <= 0 || setAssociativity <= 0 || cacheSize % (blockSize * setAssociativity) != 0
+        || !isValidConfig(cacheSize, blockSize, setAssociativity)){
+        throw std::invalid_argument("Invalid configuration for L" + std::to_string(level) + ": " + std::to_string(cacheSize)
+            + " bytes, " + std::to_string(blockSize) + "-byte blocks, " + std::to_string(setAssociativity) + "-way");
     }
 
     // 입력된 캐시 속성들을 객체 변수에 저장
@@ -79,12 +91,19 @@ Cache::Cache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::st
     this->level = level;
     this->policy = policy;
     this->memAccs = 0;
+    this->hits = 0;
+    this->misses = 0;
+    this->debug = false;
 
     // 캐시 블록 메모리를 동적 할당 (총 캐시 크기 / 블록 크기만큼 공간 할당)
-    cacheBlocks = (ll*)malloc(cacheSize/blockSize * sizeof(ll));
-    if(cacheBlocks == NULL){ // 메모리 할당 실패 처리
-        printf("Failed to allocate memory for L%d cache\n", this->level);
-        exit(0);
+    cacheBlocks = NULL;
+    if(allocateTags){
+        cacheBlocks = (ll*)malloc(cacheSize/blockSize * sizeof(ll));
+        if(cacheBlocks == NULL){ // 메모리 할당 실패 처리
+            throw std::runtime_error("Failed to allocate memory for L" + std::to_string(level) + " cache");
+        }
+        // 빈 블록은 -1 (어떤 태그와도 일치하지 않음)
+        memset(cacheBlocks, -1, cacheSize/blockSize * sizeof(ll));
     }
 
     // 세트의 개수를 계산: 캐시 크기 / (블록 크기 * 연관도)
@@ -95,6 +114,43 @@ Cache::Cache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::st
 
     // 세트 개수를 기반으로 인덱스 크기 계산 (log2(numberOfSets))
     indexSize = log2(numberOfSets);
+
+    // 세트 수가 2의 거듭제곱이 아니면 비트 선택 대신 나머지 연산으로 인덱스를 구함
+    indexSets = numberOfSets;
+    indexFunction = ((1LL<<indexSize) == numberOfSets) ? INDEX_BITS : INDEX_MODULO;
+}
+
+bool Cache::supportsSkew(){
+    return false;
+}
+
+bool Cache::supportsShadow(){
+    return true;
+}
+
+void Cache::setIndexFunction(IndexFunction function){
+    bool powerOfTwo = (1LL<<indexSize) == numberOfSets;
+    if(function == INDEX_BITS && !powerOfTwo){
+        function = INDEX_MODULO;
+    }
+    if((function == INDEX_XOR || function == INDEX_SKEW) && !powerOfTwo){
+        throw std::invalid_argument("L" + std::to_string(level) + ": xor/skew indexing needs a power-of-two number of sets (got "
+            + std::to_string(numberOfSets) + ")");
+    }
+    if(function == INDEX_SKEW && !supportsSkew()){
+        throw std::invalid_argument("L" + std::to_string(level) + ": " + policy
+            + " keeps per-set replacement state and cannot use skew indexing");
+    }
+
+    indexFunction = function;
+    indexSets = numberOfSets;
+    if(function == INDEX_PRIME){
+        while(indexSets > 1 && !isPrime(indexSets)) indexSets--;
+    }
+}
+
+IndexFunction Cache::getIndexFunction(){
+    return indexFunction;
 }
 
 void Cache::incHits(){
@@ -117,18 +173,74 @@ int Cache::getLevel(){
     return level;
 }
 
+// 비트 선택 외의 인덱스 함수에서는 인덱스 비트로 태그를 복원할 수 없으므로 라인 주소 전체를 태그로 씀
 ll Cache::getTag(ll address){
-    return address>>(indexSize + offsetSize);
+    if(indexFunction == INDEX_BITS){
+        return address>>(indexSize + offsetSize);
+    }
+    return address>>offsetSize;
 }
 
 ll Cache::getIndex(ll address){
-    return (address>>offsetSize) & ((1<<indexSize)-1);
+    ll line = address>>offsetSize;
+    switch(indexFunction){
+        case INDEX_BITS:
+            return line & ((1LL<<indexSize)-1);
+        case INDEX_XOR: {
+            ll index = line;
+            if(indexSize > 0){
+                for(unsigned long long upper = (unsigned long long)line >> indexSize; upper; upper >>= indexSize){
+                    index ^= upper;
+                }
+            }
+            return index & ((1LL<<indexSize)-1);
+        }
+        case INDEX_SKEW:
+            return getIndex(address, 0);
+        default: // INDEX_MODULO, INDEX_PRIME
+            return (unsigned long long)line % indexSets;
+    }
+}
+
+ll Cache::getIndex(ll address, ll way){
+    if(indexFunction != INDEX_SKEW){
+        return getIndex(address);
+    }
+    if(indexSize == 0){
+        return 0;
+    }
+    unsigned long long line = (unsigned long long)address >> offsetSize;
+    return (line * skewMultiplier(way)) >> (64 - indexSize);
 }
 
 ll Cache::getMemAccs(){
     return memAccs;
 }
 
+// 블록에 들어 있는 라인의 시작 주소 (빈 블록이면 -1)
+ll Cache::getLineAddress(ll block){
+    ll tag = cacheBlocks[block];
+    if(tag == -1){
+        return -1;
+    }
+    if(indexFunction == INDEX_BITS){
+        return ((tag<<indexSize) | (block/setAssociativity))<<offsetSize;
+    }
+    return tag<<offsetSize;
+}
+
+void Cache::invalidate(ll block){
+    cacheBlocks[block] = -1;
+}
+
+ll Cache::getNumberOfSets(){
+    return numberOfSets;
+}
+
+ll Cache::getSetAssociativity(){
+    return setAssociativity;
+}
+
 ll Cache::getBlockPosition(ll address){
     // 주어진 주소로부터 인덱스 값을 계산
     ll index = getIndex(address);
@@ -136,6 +248,17 @@ ll Cache::getBlockPosition(ll address){
     // 주어진 주소로부터 태그 값을 계산
     ll tag = getTag(address);
 
+    // skewed 인덱스에서는 way마다 다른 세트를 확인
+    if(indexFunction == INDEX_SKEW){
+        for(ll way = 0; way < setAssociativity; way++){
+            ll block = getWayBlock(address, index, way);
+            if(tag == cacheBlocks[block]){
+                return block;
+            }
+        }
+        return -1;
+    }
+
     // 지정된 세트 내에서 태그가 일치하는 블록을 찾음
     ll iterator;
     for(iterator=index*setAssociativity; iterator<(index+1)*setAssociativity; iterator++){
@@ -149,15 +272,26 @@ ll Cache::getBlockPosition(ll address){
 
 
 void Cache::insert(ll address, ll blockToReplace){
-    #ifdef DEBUG
-    if(getIndex(address) != blockToReplace/setAssociativity){
-        printf("ERROR: Invalid insertion: Address %x placed in block %lld", address, blockToReplace);
-    }
-    #endif
     incMemAccs();
     cacheBlocks[blockToReplace] = getTag(address);
 }
 
+void Cache::insert(Access access, ll blockToReplace){
+    insert(access.address, blockToReplace);
+}
+
+void Cache::writeTag(ll address, ll blockToReplace){
+    cacheBlocks[blockToReplace] = getTag(address);
+}
+
+bool Cache::isValidPlacement(ll address, ll block){
+    return getIndex(address, block%setAssociativity) == block/setAssociativity;
+}
+
+void Cache::setDebug(bool debug){
+    this->debug = debug;
+}
+
 ll Cache::getHits(){
     return hits;
 }
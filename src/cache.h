@@ -11,6 +11,15 @@ struct Access {
     ll address;      // 메모리 주소
 };
 
+// 주소 -> 세트 인덱스 함수
+enum IndexFunction {
+    INDEX_BITS,   // 인덱스 비트 선택 (기본)
+    INDEX_MODULO, // 라인 주소 % 세트 수 (세트 수가 2의 거듭제곱이 아닐 때)
+    INDEX_XOR,    // 상위 비트를 인덱스 비트에 XOR로 접어 넣음
+    INDEX_PRIME,  // 라인 주소 % (세트 수 이하의 최대 소수)
+    INDEX_SKEW    // way마다 다른 해시를 쓰는 skewed-associative 인덱스
+};
+
 // classes defined
 class Cache;
 
@@ -18,11 +27,7 @@ class Cache;
 bool isValidConfig(ll cs, ll bs, ll sa);
 ll hexToDec(char hexVal[]);
 int log2(ll x);
-
-void incReads();
-void incWrites();
-ll getReads();
-ll getWrites();
+bool parseIndexFunction(const std::string& name, IndexFunction& function);
 
 
 // cache class
@@ -44,9 +49,32 @@ class Cache{
         std::string getPolicy();
         ll getTag(ll address);
         ll getIndex(ll address);
+        ll getIndex(ll address, ll way);
+        // 세트 수나 정책이 함수를 지원하지 않으면 std::invalid_argument
+        void setIndexFunction(IndexFunction function);
+        IndexFunction getIndexFunction();
+
+        // 세트 index 안의 way 번째 블록 (skewed 인덱스에서는 way마다 세트가 다름)
+        inline ll getWayBlock(ll address, ll index, ll way){
+            if(indexFunction == INDEX_SKEW){
+                return getIndex(address, way)*setAssociativity + way;
+            }
+            return index*setAssociativity + way;
+        }
         ll getMemAccs();
+        virtual ll getLineAddress(ll block);
+        virtual void invalidate(ll block);
+        ll getNumberOfSets();
+        ll getSetAssociativity();
         virtual ll getBlockPosition(ll address);
         virtual void insert(ll address, ll blockToReplace);
+        // 접근 타입이 필요한 정책(upgradedLRU)은 이 버전을 재정의함. 기본은 주소만 사용
+        virtual void insert(Access access, ll blockToReplace);
+        // 메모리 접근으로 세지 않고 태그만 씀 (victim cache처럼 위 레벨에서 옮겨 온 라인)
+        virtual void writeTag(ll address, ll blockToReplace);
+        // 블록이 주소의 세트에 속하는지 (디버그 모드의 정책 검증용)
+        virtual bool isValidPlacement(ll address, ll block);
+        void setDebug(bool debug);
 
         ll getHits();
         ll getMisses();
@@ -55,14 +83,29 @@ class Cache{
         virtual ll getBlockToReplace(ll address) = 0;
         virtual void update(ll blockToReplace, int status) = 0;
 
+        // 태그 배열 없이 getBlockToReplace/update 만으로 돌릴 수 있는지 (--shadow 가 태그를 따로 가짐)
+        // 태그 검색이나 삽입을 재정의해 자기 태그를 가진 정책은 false 를 반환해야 함
+        virtual bool supportsShadow();
+
         virtual ~Cache();
 
     protected:
+        // way마다 독립된 세트를 쓰는 skewed 인덱스를 지원하는지 (블록 단위 교체 상태만 가진 정책)
+        virtual bool supportsSkew();
+
+        // 크기가 0 이하이거나 cacheSize 가 blockSize*setAssociativity 로 나누어지지 않으면 std::invalid_argument
         Cache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::string policy);
+        // allocateTags 가 false 면 태그 배열(cacheBlocks)을 만들지 않음: 태그 검색, 삽입, 라인 주소,
+        // invalidate, writeTag 를 모두 재정의해 자기 태그를 쓰는 캐시(NUCA)나 태그를 따로 가진 --shadow 정책용.
+        // 정책은 생성자의 allocateTags 를 그대로 넘겨받음
+        Cache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::string policy, bool allocateTags);
         ll cacheSize;
         ll blockSize;
         ll setAssociativity;
         ll numberOfSets;
         int offsetSize;
         int indexSize;
+        bool debug; // 디버그 모드 (정책별 추가 출력)
+        IndexFunction indexFunction;
+        ll indexSets; // 실제로 사용하는 세트 수 (INDEX_PRIME에서는 세트 수보다 작음)
 };
\ No newline at end of file
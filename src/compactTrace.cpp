@@ -0,0 +1,141 @@
+#include "compactTrace.h"
+#include <stdint.h>
+#include <stdexcept>
+
+#define ll long long
+
+static void writeHeader(FILE* out, ll records, ll sourceReads, ll sourceWrites, const std::string& description){
+    int64_t fields[3] = {records, sourceReads, sourceWrites};
+    uint32_t length = description.size();
+    fwrite(COMPACT_TRACE_MAGIC, 1, 8, out);
+    fwrite(fields, sizeof(int64_t), 3, out);
+    fwrite(&length, sizeof(length), 1, out);
+    fwrite(description.data(), 1, length, out);
+}
+
+CompactTraceWriter::CompactTraceWriter(const char* path, const std::string& description){
+    out = fopen(path, "wb");
+    if(out == NULL){
+        throw std::runtime_error("Failed to open " + std::string(path) + " for writing");
+    }
+    previous = 0;
+    records = 0;
+    writeHeader(out, 0, 0, 0, description);
+}
+
+void CompactTraceWriter::write(const Access& access){
+    unsigned long long delta = (unsigned long long)access.address - (unsigned long long)previous;
+    unsigned long long zigzag = (delta << 1) ^ (unsigned long long)((ll)delta >> 63);
+    previous = access.address;
+    records++;
+
+    int first = (access.accessType == 's') | (int)((zigzag & 0x3F) << 1);
+    zigzag >>= 6;
+    if(zigzag) first |= 0x80;
+    putc_unlocked(first, out);
+    while(zigzag){
+        int byte = zigzag & 0x7F;
+        zigzag >>= 7;
+        if(zigzag) byte |= 0x80;
+        putc_unlocked(byte, out);
+    }
+}
+
+void CompactTraceWriter::close(ll sourceReads, ll sourceWrites){
+    if(out == NULL){
+        return;
+    }
+    // 헤더의 카운터만 덮어씀 (설명은 그대로)
+    int64_t fields[3] = {records, sourceReads, sourceWrites};
+    if(fseek(out, 8, SEEK_SET) == 0){
+        fwrite(fields, sizeof(int64_t), 3, out);
+    }
+    fclose(out);
+    out = NULL;
+}
+
+ll CompactTraceWriter::getRecords(){
+    return records;
+}
+
+CompactTraceWriter::~CompactTraceWriter(){
+    if(out != NULL){
+        fclose(out);
+    }
+}
+
+CompactTraceReader::CompactTraceReader(FILE* in){
+    this->in = in;
+    this->previous = 0;
+    this->consumed = 0;
+
+    char magic[8];
+    int64_t fields[3];
+    uint32_t length;
+    if(fread(magic, 1, 8, in) != 8 || memcmp(magic, COMPACT_TRACE_MAGIC, 8) != 0
+        || fread(fields, sizeof(int64_t), 3, in) != 3 || fread(&length, sizeof(length), 1, in) != 1){
+        throw std::invalid_argument("Invalid compact trace header.");
+    }
+    records = fields[0];
+    sourceReads = fields[1];
+    sourceWrites = fields[2];
+    description.resize(length);
+    if(length > 0 && fread(&description[0], 1, length, in) != length){
+        throw std::invalid_argument("Invalid compact trace header.");
+    }
+}
+
+Access CompactTraceReader::next(){
+    int first = getc_unlocked(in);
+    if(first == EOF){
+        return {-1, 0};
+    }
+
+    unsigned long long zigzag = (first >> 1) & 0x3F;
+    int shift = 6;
+    int byte = first;
+    while(byte & 0x80){
+        byte = getc_unlocked(in);
+        if(byte == EOF){
+            throw std::invalid_argument("Truncated record in compact trace.");
+        }
+        zigzag |= (unsigned long long)(byte & 0x7F) << shift;
+        shift += 7;
+    }
+    unsigned long long delta = (zigzag >> 1) ^ (0ULL - (zigzag & 1));
+    previous = (ll)((unsigned long long)previous + delta);
+
+    consumed++;
+
+    char accessType = (first & 1) ? 's' : 'l';
+    return {accessType, previous};
+}
+
+ll CompactTraceReader::getRecords(){
+    return records;
+}
+
+double CompactTraceReader::getProgress(){
+    return records > 0 ? (double)consumed/records : 1.0;
+}
+
+ll CompactTraceReader::getSourceReads(){
+    return sourceReads;
+}
+
+ll CompactTraceReader::getSourceWrites(){
+    return sourceWrites;
+}
+
+std::string CompactTraceReader::getDescription(){
+    return description;
+}
+
+bool isCompactTrace(FILE* in){
+    int first = getc(in);
+    if(first == EOF){
+        return false;
+    }
+    ungetc(first, in);
+    return first == COMPACT_TRACE_MAGIC[0];
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+#include "cache.h"
+
+#define ll long long
+
+#define COMPACT_TRACE_MAGIC "CSIMTRC1"
+
+// 바이너리 트레이스 형식
+//   헤더: magic(8) | 레코드 수(8) | 원본 읽기 수(8) | 원본 쓰기 수(8) | 설명 길이(4) | 설명
+//   레코드: 이전 주소와의 차이를 zigzag 인코딩한 varint. 첫 바이트의 0번 비트가 쓰기 여부,
+//           1~6번 비트가 차이의 하위 6비트, 7번 비트가 다음 바이트 유무.
+// 텍스트 트레이스 한 줄(약 13바이트)이 보통 1~3바이트가 됨.
+class CompactTraceWriter{
+
+    private:
+        FILE* out;
+        ll previous;
+        ll records;
+
+    public:
+        // description: 어떤 설정으로 걸러낸 스트림인지 (헤더에 그대로 저장)
+        CompactTraceWriter(const char* path, const std::string& description);
+
+        void write(const Access& access);
+        // 헤더의 레코드 수와 원본 트레이스의 읽기/쓰기 수를 채우고 닫음
+        void close(ll sourceReads, ll sourceWrites);
+        ll getRecords();
+
+        ~CompactTraceWriter();
+};
+
+class CompactTraceReader{
+
+    private:
+        FILE* in;
+        ll previous;
+        ll records, sourceReads, sourceWrites;
+        ll consumed; // 지금까지 읽은 레코드 수
+        std::string description;
+
+    public:
+        // in 은 헤더 시작 위치여야 함
+        CompactTraceReader(FILE* in);
+
+        // 다음 접근 (끝나면 accessType == -1)
+        Access next();
+
+        ll getRecords();
+        // 읽은 레코드의 비율 (0~1)
+        double getProgress();
+        ll getSourceReads();
+        ll getSourceWrites();
+        std::string getDescription();
+};
+
+// 스트림이 compact 트레이스로 시작하는지 확인 (첫 바이트만 보고 되돌려 놓음)
+bool isCompactTrace(FILE* in);
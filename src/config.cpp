@@ -0,0 +1,99 @@
+#include "config.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <stdlib.h>
+
+#define ll long long
+
+bool LevelConfig::hasOption(const std::string& key) const{
+    return options.find(key) != options.end();
+}
+
+std::string LevelConfig::getOption(const std::string& key, const std::string& defaultValue) const{
+    std::map<std::string, std::string>::const_iterator it = options.find(key);
+    return it == options.end() ? defaultValue : it->second;
+}
+
+ll LevelConfig::getOption(const std::string& key, ll defaultValue) const{
+    std::map<std::string, std::string>::const_iterator it = options.find(key);
+    if(it == options.end()){
+        return defaultValue;
+    }
+    char* end;
+    ll value = strtoll(it->second.c_str(), &end, 10);
+    if(*end != '\0'){
+        throw std::invalid_argument("Invalid value for " + key + ": " + it->second);
+    }
+    return value;
+}
+
+ll parseSize(const std::string& key, const std::string& value){
+    char* end;
+    ll size = strtoll(value.c_str(), &end, 0);
+    switch(*end){
+        case 'k': case 'K': size <<= 10; end++; break;
+        case 'm': case 'M': size <<= 20; end++; break;
+        case 'g': case 'G': size <<= 30; end++; break;
+        default: break;
+    }
+    if(*end != '\0' || value.empty()){
+        throw std::invalid_argument("Invalid value for " + key + ": " + value);
+    }
+    return size;
+}
+
+std::string describeLevel(const LevelConfig& level){
+    std::ostringstream line;
+    line << level.policy << " " << level.cacheSize << " " << level.blockSize << " " << level.setAssociativity;
+    for(std::map<std::string, std::string>::const_iterator it = level.options.begin(); it != level.options.end(); it++){
+        line << " " << it->first << "=" << it->second;
+    }
+    return line.str();
+}
+
+LevelConfig parseLevel(const std::string& line, int level){
+    std::istringstream fields(line);
+    LevelConfig config;
+    if(!(fields >> config.policy >> config.cacheSize >> config.blockSize >> config.setAssociativity)){
+        throw std::invalid_argument("Invalid configuration for L" + std::to_string(level) + ": " + line);
+    }
+
+    // 나머지 토큰은 key=value 옵션
+    std::string option;
+    while(fields >> option){
+        size_t split = option.find('=');
+        if(split == std::string::npos || split == 0){
+            throw std::invalid_argument("Invalid option for L" + std::to_string(level) + ": " + option + " (expected key=value)");
+        }
+        config.options[option.substr(0, split)] = option.substr(split+1);
+    }
+    return config;
+}
+
+std::vector<LevelConfig> readConfig(const char* path){
+    std::ifstream params(path);
+    if(!params.is_open()){
+        throw std::invalid_argument(std::string("Failed to open configuration ") + (path ? path : "(null)"));
+    }
+
+    int levels;
+    if(!(params >> levels) || levels <= 0){
+        throw std::invalid_argument(std::string("Invalid number of levels in ") + path);
+    }
+
+    std::vector<LevelConfig> config;
+    std::string line;
+    while((int)config.size() < levels && std::getline(params, line)){
+        if(line.find_first_not_of(" \t\r") == std::string::npos){
+            continue; // 빈 줄
+        }
+        config.push_back(parseLevel(line, config.size()+1));
+    }
+
+    if((int)config.size() != levels){
+        throw std::invalid_argument("Expected " + std::to_string(levels) + " levels in " + path + " but found "
+            + std::to_string(config.size()));
+    }
+    return config;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#define ll long long
+
+// params.cfg 의 레벨 한 줄
+//   <policy> <cacheSize> <blockSize> <setAssociativity> [key=value ...]
+struct LevelConfig {
+    std::string policy;
+    ll cacheSize;
+    ll blockSize;
+    ll setAssociativity;
+    std::map<std::string, std::string> options; // 레벨별 추가 옵션
+
+    bool hasOption(const std::string& key) const;
+    std::string getOption(const std::string& key, const std::string& defaultValue) const;
+    ll getOption(const std::string& key, ll defaultValue) const; // 정수가 아니면 std::invalid_argument
+};
+
+// 아래 함수들은 형식이 잘못되면 std::invalid_argument 를 던짐
+
+// params.cfg 의 레벨 한 줄을 해석 (level 은 오류 메시지용 번호)
+LevelConfig parseLevel(const std::string& line, int level);
+
+// 레벨 설정을 params.cfg 한 줄 형식으로 (옵션은 키 순서)
+std::string describeLevel(const LevelConfig& level);
+
+// 123, 64K, 64M, 1G 형식의 크기 (0x 접두사도 허용, key는 오류 메시지용)
+ll parseSize(const std::string& key, const std::string& value);
+
+// 설정 파일을 읽어 레벨별 설정을 반환
+std::vector<LevelConfig> readConfig(const char* path);
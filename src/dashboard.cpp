@@ -0,0 +1,126 @@
+#include "dashboard.h"
+#include <chrono>
+#include <ncurses.h>
+
+#define ll long long
+
+#define valueOffset 30
+#define hitRateOffset 55
+#define hitsOffset 30 // 레벨 첫 줄에서는 구간 히트율
+#define missesOffset 55
+#define levelRow(i) (6 + 3 * (i))
+
+Dashboard::Dashboard(const std::vector<Cache*>& caches) : hits(caches.size()), misses(caches.size()){
+    this->caches = caches;
+    for(size_t i = 0; i < caches.size(); i++){
+        labels.push_back("L" + std::to_string(caches[i]->getLevel()) + ": " + caches[i]->getPolicy());
+        hits[i].store(0, std::memory_order_relaxed);
+        misses[i].store(0, std::memory_order_relaxed);
+    }
+    reads.store(0, std::memory_order_relaxed);
+    writes.store(0, std::memory_order_relaxed);
+    progress.store(-1, std::memory_order_relaxed);
+    running.store(false);
+}
+
+void Dashboard::drawOutline(){
+    mvprintw(0, 0, "Total Number Of Instructions:");
+    mvprintw(1, 0, "Number of Reads             :");
+    mvprintw(2, 0, "Number of Writes            :");
+    mvprintw(3, 0, "Throughput (accesses/s)     :");
+    mvprintw(4, 0, "Elapsed                     :");
+    for(size_t i = 0; i < caches.size(); i++){
+        attron(A_BOLD);
+        mvprintw(levelRow(i), 0, "%s", labels[i].c_str());
+        attroff(A_BOLD);
+    }
+    refresh();
+}
+
+// interval: 직전 프레임 이후 지난 시간 (초)
+void Dashboard::drawFrame(double elapsed, double interval, std::vector<ll>& lastHits, std::vector<ll>& lastMisses, ll& lastAccesses){
+    ll r = reads.load(std::memory_order_relaxed);
+    ll w = writes.load(std::memory_order_relaxed);
+    ll p = progress.load(std::memory_order_relaxed);
+    ll accesses = r + w;
+
+    mvprintw(0, valueOffset, "%lld", accesses); clrtoeol();
+    mvprintw(1, valueOffset, "%lld", r); clrtoeol();
+    mvprintw(2, valueOffset, "%lld", w); clrtoeol();
+    mvprintw(3, valueOffset, "%.0f (average %.0f)", interval > 0 ? (accesses - lastAccesses) / interval : 0.0,
+        elapsed > 0 ? accesses / elapsed : 0.0); clrtoeol();
+    // 남은 시간은 지금까지의 평균 속도로 추정
+    if(p > 0){
+        double done = p / 1e6;
+        mvprintw(4, valueOffset, "%.1f s   %.1f%%   ETA: %.1f s", elapsed, 100 * done, elapsed * (1 - done) / done);
+    }
+    else{
+        mvprintw(4, valueOffset, "%.1f s   ETA: unknown", elapsed);
+    }
+    clrtoeol();
+    lastAccesses = accesses;
+
+    for(size_t i = 0; i < caches.size(); i++){
+        ll h = hits[i].load(std::memory_order_relaxed);
+        ll m = misses[i].load(std::memory_order_relaxed);
+        ll intervalHits = h - lastHits[i];
+        ll intervalAccesses = intervalHits + m - lastMisses[i];
+        int row = levelRow(i);
+        mvprintw(row, hitsOffset, "Interval: ");
+        if(intervalAccesses > 0) printw("%f", (double)intervalHits / intervalAccesses);
+        else printw("-");
+        clrtoeol();
+        mvprintw(row, hitRateOffset, "Hit Rate: %f", h + m == 0 ? 0.0 : (double)h / (h + m)); clrtoeol();
+        mvprintw(row + 1, 0, "Accesses: %lld", h + m); clrtoeol();
+        mvprintw(row + 1, hitsOffset, "Hits: %lld", h); clrtoeol();
+        mvprintw(row + 1, missesOffset, "Misses: %lld", m); clrtoeol();
+        lastHits[i] = h;
+        lastMisses[i] = m;
+    }
+    refresh();
+}
+
+void Dashboard::render(){
+    std::vector<ll> lastHits(caches.size(), 0), lastMisses(caches.size(), 0);
+    ll lastAccesses = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto last = start;
+    auto frame = std::chrono::milliseconds(1000 / DASHBOARD_FPS);
+
+    drawOutline();
+    bool more = true;
+    while(more){
+        std::this_thread::sleep_for(frame);
+        // 멈추라는 신호를 본 뒤에도 마지막 값으로 한 번 더 그림
+        more = running.load();
+        auto now = std::chrono::steady_clock::now();
+        drawFrame(std::chrono::duration<double>(now - start).count(), std::chrono::duration<double>(now - last).count(),
+            lastHits, lastMisses, lastAccesses);
+        last = now;
+    }
+}
+
+void Dashboard::start(){
+    initscr(); // curses 초기화
+    raw(); // 키보드 입력을 원시 모드로 설정
+    noecho(); // 키보드 입력이 에코되지 않도록 설정
+    curs_set(0);
+    running.store(true);
+    renderer = std::thread(&Dashboard::render, this);
+}
+
+void Dashboard::stop(){
+    if(renderer.joinable()){
+        running.store(false);
+        renderer.join();
+    }
+}
+
+void Dashboard::close(){
+    stop();
+    endwin(); // curses 세션 종료
+}
+
+Dashboard::~Dashboard(){
+    stop();
+}
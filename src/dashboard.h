@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cache.h"
+
+#define ll long long
+
+// 화면을 다시 그리는 횟수 (초당)
+#ifndef DASHBOARD_FPS
+#define DASHBOARD_FPS 10
+#endif
+
+// 시뮬레이션 스레드가 카운터를 공개하는 간격 (접근 수, 2의 거듭제곱)
+#define DASHBOARD_PUBLISH_INTERVAL 1024
+
+// -i 모드의 실시간 화면
+// 시뮬레이션 스레드는 publish()로 카운터를 relaxed store 해 두기만 하고,
+// 렌더 스레드가 고정된 프레임 속도로 그 값을 읽어 curses로 그림.
+// 처리량(accesses/s), 남은 시간, 레벨별 누적/구간 히트율을 보여 줌.
+class Dashboard{
+
+    private:
+        std::vector<Cache*> caches;
+        std::vector<std::string> labels; // "L1: lru" (렌더 스레드는 Cache를 직접 읽지 않음)
+
+        std::vector<std::atomic<ll> > hits, misses;
+        std::atomic<ll> reads, writes;
+        std::atomic<ll> progress; // 백만분율 (모르면 -1)
+        std::atomic<bool> running;
+        std::thread renderer;
+
+        void render();
+        void drawOutline();
+        void drawFrame(double elapsed, double interval, std::vector<ll>& lastHits, std::vector<ll>& lastMisses, ll& lastAccesses);
+
+    public:
+        // caches: 화면에 보일 캐시 (계층의 레벨과 --shadow 정책들)
+        Dashboard(const std::vector<Cache*>& caches);
+
+        // 시뮬레이션 스레드에서 호출 (progress: 0~1, 모르면 음수)
+        inline void publish(ll reads, ll writes, double progress){
+            for(size_t i = 0; i < caches.size(); i++){
+                hits[i].store(caches[i]->getHits(), std::memory_order_relaxed);
+                misses[i].store(caches[i]->getMisses(), std::memory_order_relaxed);
+            }
+            this->reads.store(reads, std::memory_order_relaxed);
+            this->writes.store(writes, std::memory_order_relaxed);
+            this->progress.store(progress < 0 ? -1 : (ll)(progress * 1e6), std::memory_order_relaxed);
+        }
+
+        // curses를 초기화하고 렌더 스레드를 시작
+        void start();
+        // 렌더 스레드를 멈추고 마지막 프레임을 그림 (curses 화면은 close()까지 남음)
+        void stop();
+        void close();
+
+        ~Dashboard();
+};
@@ -0,0 +1,209 @@
+#include "dram.h"
+#include "config.h"
+#include <algorithm>
+#include <limits.h>
+#include <sstream>
+#include <stdexcept>
+
+#define ll long long
+
+DRAM::DRAM(const std::string& spec){
+    channels = 1;
+    banks = 8;
+    rowSize = 8192;
+    lineSize = 64;
+    openPage = true;
+    frfcfs = true;
+    queueSize = 32;
+    tCL = 22;
+    tRCD = 22;
+    tRP = 22;
+    tRAS = 52;
+    tBURST = 4;
+    gap = 1;
+    clock = 1600;
+
+    std::istringstream fields(spec);
+    std::string option;
+    while(std::getline(fields, option, ',')){
+        if(option.empty()) continue;
+        size_t split = option.find('=');
+        if(split == std::string::npos){
+            throw std::invalid_argument("Invalid DRAM option: " + option + " (expected key=value)");
+        }
+        std::string key = option.substr(0, split), value = option.substr(split+1);
+        if(key == "channels") channels = parseSize(key, value);
+        else if(key == "banks") banks = parseSize(key, value);
+        else if(key == "row") rowSize = parseSize(key, value);
+        else if(key == "line") lineSize = parseSize(key, value);
+        else if(key == "queue") queueSize = parseSize(key, value);
+        else if(key == "tCL") tCL = parseSize(key, value);
+        else if(key == "tRCD") tRCD = parseSize(key, value);
+        else if(key == "tRP") tRP = parseSize(key, value);
+        else if(key == "tRAS") tRAS = parseSize(key, value);
+        else if(key == "tBURST") tBURST = parseSize(key, value);
+        else if(key == "gap") gap = parseSize(key, value);
+        else if(key == "clock") clock = parseSize(key, value);
+        else if(key == "page" && (value == "open" || value == "closed")) openPage = value == "open";
+        else if(key == "sched" && (value == "frfcfs" || value == "fcfs")) frfcfs = value == "frfcfs";
+        else {
+            throw std::invalid_argument("Unknown DRAM option: " + option);
+        }
+    }
+    if(channels <= 0 || banks <= 0 || lineSize <= 0 || rowSize < lineSize || rowSize % lineSize != 0
+        || queueSize <= 0 || tCL < 0 || tRCD < 0 || tRP < 0 || tRAS < 0 || tBURST <= 0 || gap < 0 || clock <= 0){
+        throw std::invalid_argument("Invalid DRAM parameters: " + spec);
+    }
+    columns = rowSize / lineSize;
+
+    channel.resize(channels);
+    for(ll c = 0; c < channels; c++){
+        channel[c].banks.assign(banks, Bank{-1, 0, 0});
+        channel[c].time = 0;
+        channel[c].busFree = 0;
+        channel[c].draining = false;
+    }
+    stall = 0;
+    reads = 0;
+    writes = 0;
+    rowHits = 0;
+    rowEmpty = 0;
+    rowConflicts = 0;
+    readLatency = 0;
+    readQueueing = 0;
+    writeQueueing = 0;
+    stalls = 0;
+    lastCompletion = 0;
+}
+
+void DRAM::issue(Channel& ch, std::deque<Request>& queue, size_t position, ll start){
+    Request request = queue[position];
+    queue.erase(queue.begin() + position);
+    Bank& bank = ch.banks[request.bank];
+
+    // 열린 행이면 CAS만, 닫혀 있으면 ACT + CAS, 다른 행이 열려 있으면 PRE + ACT + CAS
+    // (PRE는 행을 연 뒤 tRAS 가 지나야 낼 수 있음)
+    ll cas = start;
+    if(bank.openRow == request.row){
+        rowHits++;
+    }
+    else if(bank.openRow == -1){
+        rowEmpty++;
+        bank.activated = start;
+        cas = start + tRCD;
+    }
+    else{
+        rowConflicts++;
+        bank.activated = std::max(start, bank.activated + tRAS) + tRP;
+        cas = bank.activated + tRCD;
+    }
+    ll dataStart = std::max(cas + tCL, ch.busFree);
+    ll dataEnd = dataStart + tBURST;
+    ch.busFree = dataEnd;
+    if(openPage){
+        // 같은 행의 다음 CAS는 burst 하나 뒤에 낼 수 있음
+        bank.openRow = request.row;
+        bank.readyAt = dataStart - tCL + tBURST;
+    }
+    else{
+        // 자동 precharge
+        bank.openRow = -1;
+        bank.readyAt = std::max(dataEnd, bank.activated + tRAS) + tRP;
+    }
+    ch.time = start + 1; // 명령 버스는 사이클마다 명령 하나
+
+    if(request.write){
+        writeQueueing += start - request.arrival;
+    }
+    else{
+        readQueueing += start - request.arrival;
+        readLatency += dataEnd - request.arrival;
+    }
+    lastCompletion = std::max(lastCompletion, dataEnd);
+}
+
+void DRAM::advance(Channel& ch, ll until, bool force){
+    while(true){
+        // 쓰기 큐가 3/4 이상 차면 1/4 이하가 될 때까지 쓰기를 먼저 처리 (읽기 큐가 비어도 쓰기를 처리)
+        if(!ch.draining && (ll)ch.writes.size() * 4 >= queueSize * 3) ch.draining = true;
+        if(ch.draining && (ll)ch.writes.size() * 4 <= queueSize) ch.draining = false;
+        std::deque<Request>& queue = (ch.draining || ch.reads.empty()) ? ch.writes : ch.reads;
+        if(queue.empty()) return;
+
+        // FR-FCFS: 뱅크가 준비된 요청 중 열린 행에 맞는 가장 오래된 요청, 없으면 준비된 가장 오래된 요청.
+        // 준비된 요청이 없으면 가장 먼저 준비되는 뱅크의 요청. FCFS는 항상 가장 오래된 요청.
+        size_t chosen = 0;
+        if(frfcfs){
+            ll hit = -1, ready = -1, earliest = -1;
+            for(size_t i = 0; i < queue.size(); i++){
+                Bank& bank = ch.banks[queue[i].bank];
+                if(bank.readyAt <= ch.time){
+                    if(hit == -1 && bank.openRow == queue[i].row) hit = i;
+                    if(ready == -1) ready = i;
+                }
+                if(earliest == -1 || bank.readyAt < ch.banks[queue[earliest].bank].readyAt) earliest = i;
+            }
+            chosen = hit != -1 ? hit : ready != -1 ? ready : earliest;
+        }
+        ll start = std::max(std::max(ch.time, ch.banks[queue[chosen].bank].readyAt), queue[chosen].arrival);
+        if(!force && start > until){
+            ch.time = std::max(ch.time, until);
+            return;
+        }
+        issue(ch, queue, chosen, start);
+        if(force) return;
+    }
+}
+
+void DRAM::access(const Access& access, ll accesses){
+    ll line = (unsigned long long)access.address / lineSize;
+    ll rest = line / columns;
+    Channel& ch = channel[rest % channels];
+    rest /= channels;
+    Request request = {accesses * gap + stall, rest % banks, rest / banks, access.accessType == 's'};
+    if(request.write) writes++;
+    else reads++;
+
+    advance(ch, request.arrival, false);
+    // 큐가 차면 자리가 날 때까지 코어가 멈춤
+    std::deque<Request>& queue = request.write ? ch.writes : ch.reads;
+    if((ll)queue.size() >= queueSize){
+        while((ll)queue.size() >= queueSize) advance(ch, LLONG_MAX, true);
+        if(ch.time > request.arrival){
+            stall += ch.time - request.arrival;
+            request.arrival = ch.time;
+        }
+        stalls++;
+    }
+    queue.push_back(request);
+}
+
+void DRAM::finish(){
+    for(ll c = 0; c < channels; c++){
+        while(!channel[c].reads.empty() || !channel[c].writes.empty()){
+            advance(channel[c], LLONG_MAX, true);
+        }
+    }
+}
+
+void DRAM::report(){
+    ll requests = reads + writes;
+    ll rowAccesses = rowHits + rowEmpty + rowConflicts;
+    std::string row = rowSize % 1024 == 0 ? std::to_string(rowSize >> 10) + " KB" : std::to_string(rowSize) + " B";
+    printf("DRAM: %lld channel(s) x %lld banks, %s rows, %s page, %s\n", channels, banks, row.c_str(),
+        openPage ? "open" : "closed", frfcfs ? "FR-FCFS" : "FCFS");
+    printf("  Reads: %lld\t\tWrites: %lld\n", reads, writes);
+    printf("  Row hits: %lld\t\tRow empty: %lld\t\tRow conflicts: %lld\t\tRow Hit Rate: %f\n", rowHits, rowEmpty,
+        rowConflicts, rowAccesses == 0 ? 0.0 : (double)rowHits/rowAccesses);
+
+    // 바이트/사이클 x MHz = MB/s
+    double peak = (double)channels * lineSize / tBURST;
+    double achieved = lastCompletion == 0 ? 0.0 : (double)requests * lineSize / lastCompletion;
+    printf("  Bandwidth: %.2f GB/s (%.1f%% of %.2f GB/s peak) over %lld cycles\n", achieved * clock / 1000,
+        100 * achieved / peak, peak * clock / 1000, lastCompletion);
+    printf("  Average read latency: %.1f cycles\t\tAverage queueing: %.1f cycles (reads), %.1f cycles (writes)\n",
+        reads == 0 ? 0.0 : (double)readLatency/reads, reads == 0 ? 0.0 : (double)readQueueing/reads,
+        writes == 0 ? 0.0 : (double)writeQueueing/writes);
+    printf("  Full-queue stalls: %lld (%lld cycles)\n", stalls, stall);
+    printf("\n");
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <deque>
+#include <string>
+#include <vector>
+#include "cache.h"
+
+#define ll long long
+
+// 마지막 레벨 뒤의 DRAM (--dram <spec>)
+// 캐시 계층은 write-through, write-allocate 이므로 모든 레벨에서 미스난 접근은 (store 도) 라인 읽기가 되고,
+// store 는 히트 여부와 관계없이 쓰기가 됨. 요청을 채널/뱅크/행으로 나눠 채널별 읽기/쓰기 큐에 넣고,
+// 큐에서 FR-FCFS (열린 행에 맞는 요청 먼저, 그다음 오래된 순) 또는 FCFS로 꺼내 처리함.
+// 트레이스에는 시각이 없으므로 접근 하나마다 gap 사이클이 지난다고 보고, 큐가 차면 코어가 멈춘 것으로 침.
+// 시간 단위는 DRAM 클럭 사이클.
+//
+// 주소 매핑 (하위부터): 라인 안 오프셋 | 행 안의 열 | 채널 | 뱅크 | 행
+// 같은 행을 순서대로 읽는 스트림은 행 버퍼에서 히트함.
+//
+// spec: key=value[,key=value...]
+//   channels=<n>        채널 수 (기본 1)
+//   banks=<n>           채널당 뱅크 수 (기본 8)
+//   row=<bytes>         행 버퍼 크기 (기본 8K)
+//   line=<bytes>        요청 하나의 크기 (기본 64)
+//   page=open|closed    열린 행을 남겨 둘지, 접근마다 닫을지 (기본 open)
+//   sched=frfcfs|fcfs   스케줄링 (기본 frfcfs)
+//   queue=<entries>     채널별 읽기 큐와 쓰기 큐의 크기 (기본 32)
+//   tCL, tRCD, tRP, tRAS, tBURST=<cycles>   타이밍 (기본 DDR4-3200: 22, 22, 22, 52, 4)
+//   gap=<cycles>        트레이스 접근 사이의 시간 (기본 1)
+//   clock=<MHz>         대역폭을 GB/s로 바꿀 때 쓰는 클럭 (기본 1600)
+
+class DRAM{
+
+    private:
+        struct Request {
+            ll arrival;
+            ll bank, row;
+            bool write;
+        };
+        struct Bank {
+            ll openRow;  // -1 이면 닫힘
+            ll readyAt;  // 다음 명령을 받을 수 있는 시각
+            ll activated; // 열린 행을 연 시각 (tRAS 가 지나야 닫을 수 있음)
+        };
+        struct Channel {
+            std::deque<Request> reads, writes;
+            std::vector<Bank> banks;
+            ll time;     // 다음 명령을 낼 수 있는 시각
+            ll busFree;  // 데이터 버스가 비는 시각
+            bool draining; // 쓰기 큐를 비우는 중
+        };
+
+        ll channels, banks, rowSize, lineSize, columns;
+        bool openPage, frfcfs;
+        ll queueSize;
+        ll tCL, tRCD, tRP, tRAS, tBURST;
+        ll gap, clock;
+        std::vector<Channel> channel;
+
+        ll stall; // 큐가 차서 코어가 멈춘 시간의 합 (이후 도착 시각을 모두 미룸)
+        ll reads, writes;
+        ll rowHits, rowEmpty, rowConflicts;
+        ll readLatency, readQueueing, writeQueueing;
+        ll stalls;
+        ll lastCompletion;
+
+        // 시각 until 전에 시작할 수 있는 요청을 모두 냄 (force 면 until과 관계없이 하나만)
+        void advance(Channel& ch, ll until, bool force);
+        void issue(Channel& ch, std::deque<Request>& queue, size_t position, ll start);
+
+    public:
+        // spec 이 잘못되면 std::invalid_argument
+        DRAM(const std::string& spec);
+
+        // 라인 하나의 요청 ('s' 면 쓰기, 아니면 읽기. accesses: 지금까지 트레이스에서 읽은 접근 수)
+        void access(const Access& access, ll accesses);
+        // 큐에 남은 요청을 모두 처리
+        void finish();
+
+        void report();
+};
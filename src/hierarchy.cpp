@@ -0,0 +1,322 @@
+#include "hierarchy.h"
+#include "policyRegistry.h"
+#include <stdexcept>
+
+#define ll long long
+
+Cache* createCacheInstance(const std::string& policy, ll cs, ll bs, ll sa, int level, bool allocateTags){
+    Cache* cache = createPolicy(policy, cs, bs, sa, level, allocateTags);
+    if(cache == NULL){
+        std::vector<std::string> names = getPolicyNames();
+        std::string available;
+        for(size_t i = 0; i < names.size(); i++){
+            available += (i ? ", " : "") + names[i];
+        }
+        throw std::invalid_argument("Unknown policy for L" + std::to_string(level) + ": " + policy + " (available: " + available + ")");
+    }
+    return cache;
+}
+
+Cache* createConfiguredCache(const LevelConfig& config, ll cs, int level, bool allocateTags){
+    Cache* cache = createCacheInstance(config.policy, cs, config.blockSize, config.setAssociativity, level, allocateTags);
+
+    IndexFunction indexFunction;
+    std::string indexName = config.getOption("index", "bits");
+    try {
+        if(!parseIndexFunction(indexName, indexFunction)){
+            throw std::invalid_argument("Unknown index function for L" + std::to_string(level) + ": " + indexName);
+        }
+        cache->setIndexFunction(indexFunction);
+    } catch(...){
+        delete cache;
+        throw;
+    }
+    return cache;
+}
+
+Hierarchy::Hierarchy(const std::vector<LevelConfig>& config){
+    this->config = config;
+    this->firstLevel = 0;
+    build();
+}
+
+Hierarchy::Hierarchy(const std::vector<LevelConfig>& config, int firstLevel){
+    this->config = config;
+    this->firstLevel = firstLevel;
+    build();
+}
+
+Hierarchy::Hierarchy(const char* configPath){
+    this->config = readConfig(configPath);
+    this->firstLevel = 0;
+    build();
+}
+
+void Hierarchy::build(){
+    levels = config.size();
+    reads = 0;
+    writes = 0;
+    debug = false;
+    profiler = NULL;
+    cache.assign(levels, (Cache*)NULL);
+    victim.assign(levels, (VictimCache*)NULL);
+    mshr.assign(levels, (MSHR*)NULL);
+
+    // 각 캐시 레벨의 설정으로 캐시 객체를 생성 (실패하면 만든 레벨을 정리하고 다시 던짐)
+    try {
+        for(int level = 0; level < levels; level++){
+            buildLevel(level);
+        }
+    } catch(...){
+        release();
+        throw;
+    }
+    selectAccessFunction();
+}
+
+void Hierarchy::buildLevel(int level){
+    const std::string& policy = config[level].policy; // 이 레벨의 교체 정책 이름
+
+    // plugin=<path>: 정책(또는 victimPolicy)을 등록하는 .so 를 먼저 읽음
+    if(config[level].hasOption("plugin")){
+        std::string error;
+        if(!loadPolicyPlugin(config[level].getOption("plugin", ""), error)){
+            throw std::invalid_argument("L" + std::to_string(firstLevel + level + 1) + ": failed to load policy plugin "
+                + config[level].getOption("plugin", "") + ": " + error);
+        }
+    }
+
+    // banks=<N>이면 레벨을 N개의 뱅크로 나눈 NUCA 레벨을 만듦
+    ll banks = config[level].getOption("banks", 1LL);
+    if(banks > 1){
+        if(policy == "upgradedLRU" || config[level].cacheSize % banks != 0){
+            throw std::invalid_argument("L" + std::to_string(firstLevel + level + 1) + ": cannot split " + policy + " into "
+                + std::to_string(banks) + " banks");
+        }
+        ll sockets = config[level].getOption("sockets", 1LL);
+        ll core = config[level].getOption("core", 0LL);
+        if(sockets < 1 || sockets > banks){
+            throw std::invalid_argument("L" + std::to_string(firstLevel + level + 1) + ": sockets must be between 1 and "
+                + std::to_string(banks) + " (banks), got " + std::to_string(sockets));
+        }
+        if(core < 0 || core >= banks){
+            throw std::invalid_argument("L" + std::to_string(firstLevel + level + 1) + ": core must be a bank tile between 0 and "
+                + std::to_string(banks - 1) + ", got " + std::to_string(core));
+        }
+        std::vector<Cache*> bankCaches;
+        try {
+            for(ll bank = 0; bank < banks; bank++){
+                bankCaches.push_back(createConfiguredCache(config[level], config[level].cacheSize / banks, firstLevel + level + 1, true));
+            }
+        } catch(...){
+            for(size_t bank = 0; bank < bankCaches.size(); bank++) delete bankCaches[bank];
+            throw;
+        }
+        cache[level] = new NUCACache(config[level].cacheSize, config[level].blockSize,
+            config[level].setAssociativity, firstLevel + level + 1, bankCaches,
+            sockets, core,
+            config[level].getOption("hopLatency", 1LL), config[level].getOption("bankLatency", 10LL),
+            config[level].getOption("socketLatency", 50LL));
+    } else {
+        cache[level] = createConfiguredCache(config[level], config[level].cacheSize, firstLevel + level + 1, true);
+    }
+
+    // victim=<entries> [victimPolicy=<policy>]: 레벨에서 쫓겨난 라인을 받는 fully-associative 버퍼
+    if(config[level].hasOption("victim")){
+        ll entries = config[level].getOption("victim", 0LL);
+        std::string victimPolicy = config[level].getOption("victimPolicy", "lru");
+        if(entries <= 0 || policy == "upgradedLRU"){
+            throw std::invalid_argument("L" + std::to_string(firstLevel + level + 1)
+                + ": victim cache needs a positive number of entries and a non-sectored policy");
+        }
+        ll bs = config[level].blockSize;
+        victim[level] = new VictimCache(createCacheInstance(victimPolicy, entries*bs, bs, entries, firstLevel + level + 1, true));
+    }
+
+    // mshr=<entries> [mshrLatency=<accesses>]: 처리 중인 미스 추적
+    if(config[level].hasOption("mshr")){
+        ll entries = config[level].getOption("mshr", 0LL);
+        ll latency = config[level].getOption("mshrLatency", 20LL);
+        if(entries <= 0 || latency <= 0){
+            throw std::invalid_argument("L" + std::to_string(firstLevel + level + 1)
+                + ": MSHR needs a positive number of entries and a positive mshrLatency");
+        }
+        mshr[level] = new MSHR(entries, latency);
+    }
+}
+
+void Hierarchy::enableStats(ll interval){
+    if(stats.empty()){
+        for(int level = 0; level < levels; level++){
+            stats.push_back(new CacheStats(cache[level], interval));
+        }
+    }
+    selectAccessFunction();
+}
+
+void Hierarchy::enableProfile(){
+    if(profiler == NULL){
+        profiler = new Profiler(cache);
+    }
+    selectAccessFunction();
+}
+
+void Hierarchy::enableDebug(){
+    debug = true;
+    for(int level = 0; level < levels; level++){
+        cache[level]->setDebug(true);
+    }
+    selectAccessFunction();
+}
+
+void Hierarchy::selectAccessFunction(){
+    static int (Hierarchy::*const functions[8])(const Access&) = {
+        &Hierarchy::accessAs<false, false, false>, &Hierarchy::accessAs<false, false, true>,
+        &Hierarchy::accessAs<false, true, false>,  &Hierarchy::accessAs<false, true, true>,
+        &Hierarchy::accessAs<true, false, false>,  &Hierarchy::accessAs<true, false, true>,
+        &Hierarchy::accessAs<true, true, false>,   &Hierarchy::accessAs<true, true, true>
+    };
+    accessFunction = functions[(!stats.empty())*4 + debug*2 + (profiler != NULL)];
+}
+
+// Write-Through Policy
+template<bool Stats, bool Debug, bool Profile>
+int Hierarchy::accessAs(const Access& access){
+    ll address = access.address;
+    if(access.accessType == 's') writes++;
+    else reads++;
+
+    // 모든 캐시 레벨을 순회하며 데이터 찾기 시도
+    for(int level = 0; level < levels; level++){
+        // 해당 주소가 현재 캐시에 있는지 확인
+        unsigned long long phaseStart = Profile ? readTsc() : 0;
+        ll block = cache[level]->getBlockPosition(address);
+        if(Profile) phaseStart = profiler->record(level, PHASE_LOOKUP, phaseStart);
+
+        if(block == -1){ // 캐시 미스 발생
+            cache[level]->incMisses(); // 미스 카운트 증가
+            ll blockToReplace = cache[level]->getBlockToReplace(address); // 교체할 블록 선택
+            if(Profile) phaseStart = profiler->record(level, PHASE_VICTIM, phaseStart);
+            if(Debug && !cache[level]->isValidPlacement(address, blockToReplace)){
+                printf("ERROR: Invalid insertion: Address %llx placed in block %lld of L%d\n",
+                    address, blockToReplace, firstLevel + level + 1);
+            }
+            // victim cache로 보낼, 곧 쫓겨날 라인
+            ll evicted = victim[level] != NULL ? cache[level]->getLineAddress(blockToReplace) : -1;
+            // 새로운 블록 삽입 (접근 타입이 필요한 정책은 insert(Access, ll)을 재정의함)
+            cache[level]->insert(access, blockToReplace);
+            if(Profile) phaseStart = profiler->record(level, PHASE_INSERT, phaseStart);
+
+            cache[level]->update(blockToReplace, 0); // 교체 정책 업데이트 (0 = 미스)
+            if(Profile) phaseStart = profiler->record(level, PHASE_UPDATE, phaseStart);
+
+            if(Stats) stats[level]->recordMiss(blockToReplace);
+
+            // victim cache에서 찾으면 라인을 맞바꾸고 다음 레벨로 내려가지 않음
+            if(victim[level] != NULL && victim[level]->probe(address, evicted)){
+                return level;
+            }
+
+            // 다음 레벨로 내려가는 미스만 MSHR 엔트리를 차지함
+            if(mshr[level] != NULL){
+                mshr[level]->miss(address / config[level].blockSize, cache[level]->getHits() + cache[level]->getMisses());
+            }
+        } else { // 캐시 히트 발생
+            cache[level]->incHits(); // 히트 카운트 증가
+            if(mshr[level] != NULL){
+                mshr[level]->hit(address / config[level].blockSize, cache[level]->getHits() + cache[level]->getMisses());
+            }
+            cache[level]->update(block, 1); // 교체 정책 업데이트 (1 = 히트)
+            if(Profile) phaseStart = profiler->record(level, PHASE_UPDATE, phaseStart);
+
+            if(Stats) stats[level]->recordHit(block);
+            return level; // 캐시 히트가 발생하면 더 이상 다른 레벨을 검사하지 않음
+        }
+    }
+    return levels;
+}
+
+template int Hierarchy::accessAs<false, false, false>(const Access&);
+template int Hierarchy::accessAs<false, false, true>(const Access&);
+template int Hierarchy::accessAs<false, true, false>(const Access&);
+template int Hierarchy::accessAs<false, true, true>(const Access&);
+template int Hierarchy::accessAs<true, false, false>(const Access&);
+template int Hierarchy::accessAs<true, false, true>(const Access&);
+template int Hierarchy::accessAs<true, true, false>(const Access&);
+template int Hierarchy::accessAs<true, true, true>(const Access&);
+
+int Hierarchy::access(const Access& access){
+    return (this->*accessFunction)(access);
+}
+
+void Hierarchy::access(const Access* accesses, size_t count){
+    for(size_t i = 0; i < count; i++){
+        access(accesses[i]);
+    }
+}
+
+int Hierarchy::getLevels(){
+    return levels;
+}
+
+int Hierarchy::getFirstLevel(){
+    return firstLevel;
+}
+
+const LevelConfig& Hierarchy::getConfig(int level){
+    return config[level];
+}
+
+Cache* Hierarchy::getCache(int level){
+    return cache[level];
+}
+
+VictimCache* Hierarchy::getVictimCache(int level){
+    return victim[level];
+}
+
+MSHR* Hierarchy::getMSHR(int level){
+    return mshr[level];
+}
+
+Profiler* Hierarchy::getProfiler(){
+    return profiler;
+}
+
+bool Hierarchy::isStatsEnabled(){
+    return !stats.empty();
+}
+
+bool Hierarchy::isDebugEnabled(){
+    return debug;
+}
+
+ll Hierarchy::getReads(){
+    return reads;
+}
+
+ll Hierarchy::getWrites(){
+    return writes;
+}
+
+void Hierarchy::dumpStats(const char* prefix){
+    if(!stats.empty()){
+        ::dumpStats(stats, prefix);
+    }
+}
+
+void Hierarchy::release(){
+    for(int level = 0; level < levels; level++){
+        delete victim[level];
+        delete mshr[level];
+        delete cache[level];
+    }
+    for(size_t level = 0; level < stats.size(); level++){
+        delete stats[level];
+    }
+    delete profiler;
+}
+
+Hierarchy::~Hierarchy(){
+    release();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+#include "cache.h"
+#include "config.h"
+#include "victimCache.h"
+#include "mshr.h"
+#include "nuca.h"
+#include "stats.h"
+#include "profiler.h"
+
+#define ll long long
+
+// 설정으로부터 만든 캐시 계층 (libcachesim의 진입점)
+// 전역 상태가 없으므로 한 프로세스 안에서 여러 계층을 동시에, 서로 다른 스레드에서 돌릴 수 있음.
+//
+//   Hierarchy hierarchy(readConfig("params.cfg"));
+//   hierarchy.access({'l', 0x1fffff50});
+//   hierarchy.getCache(0)->getHitRate();
+//
+// 설정이 잘못되면 (알 수 없는 정책, 인덱스 함수, 플러그인 등) 생성자가 std::invalid_argument 를 던짐.
+class Hierarchy{
+
+    private:
+        std::vector<LevelConfig> config;
+        std::vector<Cache*> cache;
+        std::vector<VictimCache*> victim; // 레벨 뒤의 victim cache (없으면 NULL)
+        std::vector<MSHR*> mshr;          // 레벨의 MSHR (없으면 NULL)
+        std::vector<CacheStats*> stats;   // enableStats() 이후에만 생성
+        Profiler* profiler;               // enableProfile() 이후에만 생성
+        bool debug;
+        int levels;
+        int firstLevel; // 첫 레벨 앞에 생략된 레벨 수 (미스 스트림부터 시작한 계층)
+        ll reads, writes;
+        // 현재 모드에 맞게 특수화된 accessAs
+        int (Hierarchy::*accessFunction)(const Access&);
+
+        void build();
+        void buildLevel(int level);
+        void release();
+        void selectAccessFunction();
+
+        // 캐시 객체를 소유하므로 복사하지 않음 (선언만 하고 정의하지 않음)
+        Hierarchy(const Hierarchy&);
+        Hierarchy& operator=(const Hierarchy&);
+
+    public:
+        Hierarchy(const std::vector<LevelConfig>& config);
+        Hierarchy(const char* configPath);
+        // 위쪽 firstLevel 개 레벨의 미스 스트림을 입력으로 받는 아래쪽 계층 (레벨 번호가 firstLevel+1 부터)
+        Hierarchy(const std::vector<LevelConfig>& config, int firstLevel);
+
+        // 레벨별 온라인 통계 수집 (interval 접근 단위 구간 히트율)
+        void enableStats(ll interval);
+        // 접근 루프의 단계별 TSC 측정
+        void enableProfile();
+        // 정책이 고른 블록이 주소의 세트에 속하는지 검사하고 정책별 디버그 출력을 켬
+        void enableDebug();
+
+        // 접근 하나를 시뮬레이션하고 히트한 레벨(0부터)을 반환. 모든 레벨에서 미스면 getLevels()
+        int access(const Access& access);
+        // 여러 접근을 차례로 시뮬레이션
+        void access(const Access* accesses, size_t count);
+        // 모드를 컴파일 시간에 고정한 access. 켜지지 않은 모드의 검사는 코드에 남지 않음.
+        // 호출하는 쪽이 켜진 모드와 같은 인자를 써야 함 (8가지 조합 모두 hierarchy.cpp에서 인스턴스화)
+        template<bool Stats, bool Debug, bool Profile>
+        int accessAs(const Access& access);
+
+        int getLevels();
+        int getFirstLevel();
+        const LevelConfig& getConfig(int level);
+        Cache* getCache(int level);
+        VictimCache* getVictimCache(int level);
+        MSHR* getMSHR(int level);
+        Profiler* getProfiler();
+        bool isStatsEnabled();
+        bool isDebugEnabled();
+        ll getReads();
+        ll getWrites();
+
+        // enableStats() 이후 <prefix>.json 등으로 통계를 저장
+        void dumpStats(const char* prefix);
+
+        ~Hierarchy();
+};
+
+// 알 수 없는 정책이면 std::invalid_argument (allocateTags 가 false 면 태그 배열 없이 만듦)
+Cache* createCacheInstance(const std::string& policy, ll cs, ll bs, ll sa, int level, bool allocateTags);
+// 레벨 설정의 정책과 인덱스 함수(index=bits|mod|xor|prime|skew)로 캐시를 생성
+Cache* createConfiguredCache(const LevelConfig& config, ll cs, int level, bool allocateTags);
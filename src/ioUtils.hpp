@@ -1,19 +1,13 @@
 #include "cache.h"
+#include "hierarchy.h"
+#include "missStreamStore.h"
+#include "shadowCache.h"
+#include "tlb.h"
+#include <algorithm>
 #include <stdio.h>
-#if INTERACTIVE
-#include <ncurses.h>
-#endif
 
 #define ll long long
 
-#define instructionOffset 30
-
-#define levelOffset 0
-#define hitRateOffset 55
-#define accessesOffset 0
-#define hitsOffset 30
-#define missesOffset 55
-
 Access getNextAddress() {
     char accessType; // 'l' 또는 's' 저장
     char address[20]; // 메모리 주소 저장
@@ -29,12 +23,8 @@ Access getNextAddress() {
         throw std::invalid_argument("Invalid input format in trace file.");
     }
 
-    // 명령어 타입 처리
-    if (accessType == 'l') {
-        incReads(); // 읽기 명령 증가
-    } else if (accessType == 's') {
-        incWrites(); // 쓰기 명령 증가
-    } else {
+    // 명령어 타입 확인 (읽기/쓰기 수는 Hierarchy가 셈)
+    if (accessType != 'l' && accessType != 's') {
         throw std::invalid_argument("Invalid access type: " + std::string(1, accessType));
     }
  
@@ -42,68 +32,94 @@ Access getNextAddress() {
     return {accessType, hexToDec(address)};
 }
 
-#ifdef INTERACTIVE
-void printTraceInfoOutline(){
-    move(0, 0);
-    printw("Total Number Of Instructions:"); refresh();
-    move(1, 0);
-    printw("Number of Reads             :"); refresh();
-    move(2, 0);
-    printw("Number of Writes            :"); refresh();
+void printTraceInfo2(ll reads, ll writes){
+    printf("\n");
+    printf("Total Number Of Instructions: %lld\n", reads + writes);
+    printf("Number of Reads             : %lld\n", reads);
+    printf("Number of Writes            : %lld\n", writes);   
+    printf("\n");
 }
 
-void printTraceInfo(){
-    move(0, instructionOffset);
-    printw("%lld", getReads() + getWrites()); refresh();
-    move(1, instructionOffset);
-    printw("%lld", getReads()); refresh();
-    move(2, instructionOffset);
-    printw("%lld", getWrites()); refresh();
-}
-#endif
-void printTraceInfo2(){
+void printCacheStatus2(Cache* cache, std::chrono::milliseconds duration){
+    printf("L%d: %s\t\t\t\t\t\tHit Rate: %f\n",  
+        cache->getLevel(), cache->getPolicy().c_str(), cache->getHitRate());
+    printf("Accesses: %lld\t\tHits: %lld\t\tMisses: %lld\n",
+        cache->getHits()+cache->getMisses(), cache->getHits(), cache->getMisses());
+    printf("Duration: %lld ms\n", (ll)duration.count());
+    printf("Memory Access: %lld times\n", cache->getMemAccs());
     printf("\n");
-    printf("Total Number Of Instructions: %lld\n", getReads() + getWrites());
-    printf("Number of Reads             : %lld\n", getReads());
-    printf("Number of Writes            : %lld\n", getWrites());   
+}
+
+void printVictimCacheStatus(VictimCache* victim){
+    ll probes = victim->getHits() + victim->getMisses();
+    printf("  Victim cache: %lld entries, %s\t\tHit Rate: %f\n", victim->getEntries(), victim->getPolicy().c_str(),
+        probes == 0 ? 0.0 : (double)victim->getHits()/probes);
+    printf("  Probes: %lld\t\tHits: %lld\t\tMisses: %lld\t\tFills: %lld\n",
+        probes, victim->getHits(), victim->getMisses(), victim->getFills());
     printf("\n");
 }
 
-#ifdef INTERACTIVE
-void printCacheStatusOutline(Cache* cache){
-    int verticalOffset = 5 + 3 * (cache->getLevel()-1);
-    move(verticalOffset, levelOffset);
-    attron(A_BOLD);
-    printw("L%d: %s", cache->getLevel(), cache->getPolicy().c_str()); refresh();
-    attroff(A_BOLD);
-    move(verticalOffset, hitRateOffset);
-    printw("Hit Rate: "); refresh();
-    move(verticalOffset + 1, accessesOffset);
-    printw("Accesses: "); refresh();
-    move(verticalOffset + 1, hitsOffset);
-    printw("Hits: "); refresh();
-    move(verticalOffset + 1, missesOffset);
-    printw("Misses: "); refresh();
+void printMSHRStatus(MSHR* mshr){
+    printf("  MSHR: %lld entries, latency %lld accesses\n", mshr->getEntries(), mshr->getLatency());
+    printf("  Primary misses: %lld\t\tDelayed hits: %lld\t\tMisses with all entries busy: %lld (%lld accesses until free)\n",
+        mshr->getPrimaryMisses(), mshr->getDelayedHits(), mshr->getStalls(), mshr->getStallAccesses());
+    printf("\n");
 }
 
-void printCacheStatus(Cache* cache){
-    int verticalOffset = 5 + 3 * (cache->getLevel()-1);
-    move(verticalOffset, hitRateOffset+10);
-    printw("%f", cache->getHitRate()); refresh();
-    move(verticalOffset+1, accessesOffset+10);
-    printw("%lld", cache->getHits()+cache->getMisses()); refresh();
-    move(verticalOffset+1, hitsOffset+6);
-    printw("%lld", cache->getHits()); refresh();
-    move(verticalOffset+1, missesOffset+8);
-    printw("%lld", cache->getMisses()); refresh();
+void printNUCAStatus(NUCACache* nuca){
+    printf("  Banks: %d\t\tLoad Imbalance (max/mean): %f\n", nuca->getBanks(), nuca->getLoadImbalance());
+    printf("  Average Hops: %f\t\tAverage Latency: %f\n", nuca->getAverageHops(), nuca->getAverageLatency());
+    for (int bank = 0; bank < nuca->getBanks(); bank++) {
+        Cache* bankCache = nuca->getBankCache(bank);
+        printf("  Bank %d (%lld hops): Accesses: %lld\t\tHits: %lld\t\tMisses: %lld\n", bank, nuca->getBankHops(bank),
+            nuca->getBankAccesses(bank), bankCache->getHits(), bankCache->getMisses());
+    }
+    printf("\n");
 }
-#endif
-void printCacheStatus2(Cache* cache, std::chrono::milliseconds duration){
-    printf("L%d: %s\t\t\t\t\t\tHit Rate: %f\n",  
-        cache->getLevel()+1, cache->getPolicy().c_str(), cache->getHitRate());
+
+// --reuse 로 저장된 미스 스트림에서 가져온 레벨의 결과
+void printReusedLevelStatus(const LevelResult& result){
+    printf("L%d: %s (reused)\t\t\t\tHit Rate: %f\n", result.level, result.policy.c_str(),
+        result.hits + result.misses == 0 ? 0.0 : (double)result.hits/(result.hits + result.misses));
     printf("Accesses: %lld\t\tHits: %lld\t\tMisses: %lld\n",
-        cache->getHits()+cache->getMisses(), cache->getHits(), cache->getMisses());
-    printf("Duration: %lld ms\n", duration.count());
-    printf("Memory Access: %lld times\n", cache->getMemAccs());
+        result.hits + result.misses, result.hits, result.misses);
+    printf("Memory Access: %lld times\n", result.memAccs);
     printf("\n");
-}
\ No newline at end of file
+}
+
+// 같은 레벨을 돈 정책들을 히트율 순으로 비교
+void printShadowSummary(ShadowCache* shadow){
+    std::vector<std::pair<float, int> > ranking;
+    for (int policy = 0; policy < shadow->getPolicies(); policy++) {
+        ranking.push_back(std::make_pair(-shadow->getCache(policy)->getHitRate(), policy));
+    }
+    std::sort(ranking.begin(), ranking.end());
+    printf("Shadow policies of L%d (one pass)\n", shadow->getCache(0)->getLevel());
+    for (size_t rank = 0; rank < ranking.size(); rank++) {
+        Cache* cache = shadow->getCache(ranking[rank].second);
+        printf("  %zu. %-12s Hit Rate: %f\t\tMisses: %lld\n", rank + 1, cache->getPolicy().c_str(),
+            cache->getHitRate(), cache->getMisses());
+    }
+    printf("\n");
+}
+
+// --tlb: TLB 히트율과 page walk가 캐시 계층에 더한 미스
+void printTLBStatus(TLB* tlb, int levels){
+    printf("TLB: %lld KB pages, %d references per page walk\n", tlb->getPageSize() >> 10, tlb->getWalkLength());
+    for (int level = 0; level < tlb->getLevels(); level++) {
+        Cache* cache = tlb->getCache(level);
+        printf("  L%d TLB: %lld entries, %lld-way %s\t\tHit Rate: %f\n", level + 1,
+            cache->getNumberOfSets() * cache->getSetAssociativity(), cache->getSetAssociativity(),
+            cache->getPolicy().c_str(), cache->getHitRate());
+        printf("  Accesses: %lld\t\tHits: %lld\t\tMisses: %lld\n",
+            cache->getHits() + cache->getMisses(), cache->getHits(), cache->getMisses());
+    }
+    printf("  Page walks: %lld\t\tWalk references: %lld (included in the cache levels above)\n",
+        tlb->getWalks(), tlb->getWalkReferences());
+    printf("  Walk-induced misses:");
+    for (int level = 0; level < levels; level++) {
+        printf(" L%d: %lld", level + 1, tlb->getWalkMisses(level));
+    }
+    printf("\t\tWalk memory accesses: %lld\n", tlb->getWalkMisses(levels - 1));
+    printf("\n");
+}
@@ -4,165 +4,540 @@
 #include <fstream>
 #include <vector>
 #include <unistd.h>
+#include <getopt.h>
+#include <sstream>
+#include <stdexcept>
 #include "ioUtils.hpp" //contains I/O functions
 #include "cache.h" //contains all auxillary functions
-#include "../policies/plru.h"
-#include "../policies/lru.h"
-#include "../policies/srrip.h"
-#include "../policies/nru.h"
-#include "../policies/lfu.h"
-#include "../policies/fifo.h"
-#include "../policies/UpgradedLRU.h"
-// #include "../policies/policy.h"
+#include "hierarchy.h" //cache levels built from params.cfg
+#include "traceGen.h" //synthetic traces (-g <spec>)
+#include "compactTrace.h" //filtered miss streams (-f <out>)
+#include "sweep.h" //batch experiments (--sweep <spec>)
+#include "traceAnalysis.h" //trace characteristics (--analyze)
+#include "policyRegistry.h" //policy plugins (--plugin <so>)
+#include "traceReader.h" //trace files (-t <path>)
+#include "missStreamStore.h" //incremental re-simulation (--reuse <dir>)
+#include "shadowCache.h" //several policies in one pass (--shadow <policies>)
+#include "dashboard.h" //live view (-i)
+#include "simpoint.h" //representative intervals (--simpoint)
+#include "tlb.h" //address translation (--tlb <spec>)
+#include "dram.h" //memory behind the last level (--dram <spec>)
 
 using namespace std;
 using namespace std::chrono;
 
 #define ll long long
 
-Cache* createCacheInstance(string& policy, ll cs, ll bs, ll sa, int level){
-    
-    // check validity here and exit if invalid
-    if(policy == "plru"){
-        Cache* cache = new PLRU(cs, bs, sa, level);
-        return cache;
-    }
-    else if(policy == "lru"){
-        Cache* cache = new LRU(cs, bs, sa, level);
-        return cache;
-    }
-    else if(policy == "srrip"){
-        Cache* cache = new SRRIP(cs, bs, sa, level);
-        return cache;
-    }
-    else if(policy == "nru"){
-        Cache* cache = new NRU(cs, bs, sa, level);
-        return cache;
-    }
-    else if(policy == "lfu"){
-        Cache* cache = new LFU(cs, bs, sa, level);
-        return cache;
-    }
-    else if(policy == "fifo"){
-        Cache* cache = new FIFO(cs, bs, sa, level);
-        return cache;
-    }
-    else if(policy == "upgradedLRU"){
-        Cache* cache = new UpgradedLRU(cs, bs, sa, level, 16);
-        return cache;
-    }
-    // else if(policy == "<policy>"){
-    //     Cache* cache = new <POLICY>(cs, bs, sa, level);
-    //     return cache;
-    // }
+static void printUsage(const char* program){
+    printf("Usage: %s <config> [-t <trace>|-g <pattern>[,key=value...]] [-f <miss stream>] [-i|--interactive] [-d|--debug]\n"
+           "       [-s|--stats] [--stats-interval <N>] [--stats-prefix <prefix>] [-p|--profile] [--policy <level>=<policy>]\n"
+           "       [--plugin <policy.so>] [--reuse <dir>] [--shadow <policy>,<policy>...]\n"
+           "       [--tlb <key>=<value>[,...]] [--dram <key>=<value>[,...]] [--simpoint [--interval <N>] [--clusters <K>] [--warmup <N>]]\n"
+           "       %s --sweep <spec> [--results <csv>] [-j|--jobs <threads>]\n"
+           "       %s --analyze [--window <N>] [--line <bytes>] [--exact] [--analysis-csv <csv>] [-t <trace>|-g <pattern>[,key=value...]]\n",
+           program, program, program);
 }
 
-int main(int argc, char *argv[]){
+// 한 번의 시뮬레이션에 필요한 입력/출력
+struct Simulation {
+    Hierarchy* hierarchy;
+    TraceReader* trace;          // -t, -g (NULL이면 stdin)
+    CompactTraceReader* compact; // stdin이 compact 트레이스일 때
+    CompactTraceWriter* filter;
+    std::vector<CompactTraceWriter*> streams; // --reuse: i번째 레벨을 지나 내려가는 접근
+    ShadowCache* shadow;                      // --shadow: 모든 레벨에서 미스난 접근을 받는 마지막 레벨
+    Dashboard* dashboard;                     // -i
+    TLB* tlb;                                 // --tlb: 데이터 접근 앞에 page walk 참조를 넣음
+    DRAM* dram;                               // --dram: 모든 레벨에서 미스난 접근과 모든 store 를 받는 메모리
+};
+
+// 트레이스를 읽은 비율 (stdin의 텍스트 트레이스는 알 수 없으므로 -1)
+static double getProgress(Simulation& simulation){
+    return simulation.trace != NULL ? simulation.trace->getProgress()
+        : simulation.compact != NULL ? simulation.compact->getProgress() : -1;
+}
+
+// 계층을 지난 접근을 아래 단계로 넘김 (hitLevel: 히트한 레벨, 모든 레벨에서 미스면 levels)
+static inline void forward(Simulation& simulation, const Access& access, int hitLevel, int levels){
+    // 모든 레벨에서 미스난 접근만 다음 단계로 내려감
+    if (simulation.filter != NULL && hitLevel == levels) {
+        simulation.filter->write(access);
+    }
+    for (size_t levelItr = 0; levelItr < simulation.streams.size(); levelItr++) {
+        if (hitLevel > (int)levelItr) simulation.streams[levelItr]->write(access);
+    }
+    if (simulation.shadow != NULL && hitLevel == levels) {
+        simulation.shadow->access(access);
+    }
+    // write-through, write-allocate: 모든 레벨에서 미스나면 (store 도) 라인을 읽어 오고, store 는 히트해도 메모리에 씀
+    if (simulation.dram != NULL) {
+        ll now = simulation.hierarchy->getReads() + simulation.hierarchy->getWrites();
+        if (hitLevel == levels) simulation.dram->access({'l', access.address}, now);
+        if (access.accessType == 's') simulation.dram->access(access, now);
+    }
+}
 
-    // 입력 파일로부터 캐시 설정을 읽기 위한 ifstream 객체 생성
-    ifstream params;
-    params.open(argv[1]); // 첫 번째 인자로 받은 파일 경로를 열기
-    string word;
+// 메모리 접근을 시뮬레이션
+// 모드마다 따로 인스턴스화되므로 꺼진 모드의 검사는 루프에 남지 않음
+template<bool Interactive, bool Stats, bool Debug, bool Profile>
+static void simulate(Simulation& simulation){
+    Hierarchy& hierarchy = *simulation.hierarchy;
+    int levels = hierarchy.getLevels();
+    ll published = 0;
 
-    // 캐시 레벨(levels)의 개수를 읽어옴
-    params >> word;
-    int levels = stoi(word.c_str()); // 문자열을 정수로 변환
+    // Write-Through Policy
+    while (true) {
+        // 다음 메모리 주소를 읽어옴 (주소가 -1이면 EOF)
+        unsigned long long ingestStart = Profile ? readTsc() : 0;
+        Access access = simulation.trace != NULL ? simulation.trace->next()
+            : simulation.compact != NULL ? simulation.compact->next() : getNextAddress();
+        // 트레이스 읽기는 레벨과 무관하므로 0번 레벨에 합산함
+        if (Profile) hierarchy.getProfiler()->record(0, PHASE_INGEST, ingestStart);
+        // eof
+        if (access.accessType == -1) break;
 
-    // 캐시 레벨별로 Cache 객체 포인터를 저장할 벡터 생성
-    vector<Cache*> cache(levels);
+        // TLB 미스면 page walk 참조가 데이터보다 먼저 캐시 계층을 지나감
+        if (simulation.tlb != NULL) {
+            Access walk[TLB_MAX_WALK];
+            int references = simulation.tlb->translate(access.address, walk);
+            for (int i = 0; i < references; i++) {
+                int walkLevel = hierarchy.accessAs<Stats, Debug, Profile>(walk[i]);
+                simulation.tlb->recordWalk(walkLevel);
+                forward(simulation, walk[i], walkLevel, levels);
+            }
+        }
 
-    // 각 캐시 레벨의 설정을 반복적으로 읽음
-    int iterator = 0;
-    string policy; // 교체 정책 이름 (예: "LRU", "LFU")
-    while (iterator < levels) {
-        params >> policy;
+        // 캐시 계층에 접근 (hitLevel: 히트한 레벨, 모든 레벨에서 미스면 levels)
+        int hitLevel = hierarchy.accessAs<Stats, Debug, Profile>(access);
 
-        // 캐시 크기(cs), 블록 크기(bs), 연관도(sa)를 읽어옴
-        ll cs, bs, sa;
-        params >> word; cs = stoll(word.c_str()); // 캐시 크기
-        params >> word; bs = stoll(word.c_str()); // 블록 크기
-        params >> word; sa = stoll(word.c_str()); // 세트 연관도
+        // 화면은 렌더 스레드가 그리고, 여기서는 가끔 카운터만 공개함
+        if (Interactive && (++published & (DASHBOARD_PUBLISH_INTERVAL - 1)) == 0) {
+            simulation.dashboard->publish(hierarchy.getReads(), hierarchy.getWrites(), getProgress(simulation));
+        }
 
-        // createCacheInstance를 호출해 캐시 객체를 생성하고, 해당 레벨에 추가
-        cache[iterator++] = createCacheInstance(policy, cs, bs, sa, iterator);
+        forward(simulation, access, hitLevel, levels);
+    }
+    if (Interactive) {
+        simulation.dashboard->publish(hierarchy.getReads(), hierarchy.getWrites(), getProgress(simulation));
     }
+}
 
-    // INTERACTIVE 모드에서는 curses 라이브러리를 이용한 출력 설정
-    #if INTERACTIVE
-    initscr(); // curses 초기화
-    raw(); // 키보드 입력을 원시 모드로 설정
-    noecho(); // 키보드 입력이 에코되지 않도록 설정
-    printTraceInfoOutline(); // 디버깅 출력 틀 생성
-    for (int levelItr = 0; levelItr < levels; levelItr++) {
-        printCacheStatusOutline(cache[levelItr]); // 각 캐시의 상태를 출력
+// 실행 시간 옵션을 템플릿 인자로 바꿔 알맞은 루프를 고름
+template<bool Interactive, bool Stats, bool Debug>
+static void simulateWithProfile(Simulation& simulation, bool profile){
+    if (profile) simulate<Interactive, Stats, Debug, true>(simulation);
+    else simulate<Interactive, Stats, Debug, false>(simulation);
+}
+
+template<bool Interactive, bool Stats>
+static void simulateWithDebug(Simulation& simulation, bool debug, bool profile){
+    if (debug) simulateWithProfile<Interactive, Stats, true>(simulation, profile);
+    else simulateWithProfile<Interactive, Stats, false>(simulation, profile);
+}
+
+template<bool Interactive>
+static void simulateWithStats(Simulation& simulation, bool stats, bool debug, bool profile){
+    if (stats) simulateWithDebug<Interactive, true>(simulation, debug, profile);
+    else simulateWithDebug<Interactive, false>(simulation, debug, profile);
+}
+
+static int run(int argc, char *argv[]){
+
+    // 옵션: -t <path> 이면 stdin 대신 트레이스 파일을, -g <spec> 이면 합성 트레이스 생성기를 사용
+    // -f <out> 이면 마지막 레벨의 미스 스트림을 compact 트레이스로 저장
+    // 나머지 모드(-i, -d, -s, -p)와 레벨별 정책(--policy)도 다시 빌드하지 않고 실행 시간에 고름
+    string tracePath;
+    const char* filterPath = NULL;
+    bool interactive = false, debug = false, stats = false, profile = false;
+    ll statsInterval = STATS_INTERVAL;
+    const char* statsPrefix = STATS_PREFIX;
+    vector<string> policyOverrides;
+    const char* sweepPath = NULL;
+    const char* resultsPath = SWEEP_RESULTS;
+    int jobs = 0;
+    bool analyze = false, exact = false;
+    ll window = ANALYSIS_WINDOW, lineSize = 64;
+    const char* analysisPath = NULL;
+    const char* reusePath = NULL;
+    vector<string> shadowPolicies;
+    bool simpoint = false;
+    ll simpointInterval = SIMPOINT_INTERVAL, warmup = SIMPOINT_WARMUP;
+    int clusters = SIMPOINT_CLUSTERS;
+    const char* tlbSpec = NULL;
+    const char* dramSpec = NULL;
+
+    static struct option longOptions[] = {
+        {"trace", required_argument, NULL, 't'},
+        {"generate", required_argument, NULL, 'g'},
+        {"filter", required_argument, NULL, 'f'},
+        {"interactive", no_argument, NULL, 'i'},
+        {"debug", no_argument, NULL, 'd'},
+        {"stats", no_argument, NULL, 's'},
+        {"stats-interval", required_argument, NULL, 'I'},
+        {"stats-prefix", required_argument, NULL, 'P'},
+        {"profile", no_argument, NULL, 'p'},
+        {"policy", required_argument, NULL, 'L'},
+        {"plugin", required_argument, NULL, 'O'},
+        {"sweep", required_argument, NULL, 'W'},
+        {"results", required_argument, NULL, 'R'},
+        {"jobs", required_argument, NULL, 'j'},
+        {"analyze", no_argument, NULL, 'A'},
+        {"window", required_argument, NULL, 'N'},
+        {"line", required_argument, NULL, 'B'},
+        {"exact", no_argument, NULL, 'E'},
+        {"analysis-csv", required_argument, NULL, 'C'},
+        {"reuse", required_argument, NULL, 'U'},
+        {"shadow", required_argument, NULL, 'H'},
+        {"simpoint", no_argument, NULL, 'S'},
+        {"interval", required_argument, NULL, 'V'},
+        {"clusters", required_argument, NULL, 'K'},
+        {"warmup", required_argument, NULL, 'M'},
+        {"tlb", required_argument, NULL, 'T'},
+        {"dram", required_argument, NULL, 'D'},
+        {NULL, 0, NULL, 0}
+    };
+    int option;
+    while ((option = getopt_long(argc, argv, "t:g:f:idspj:", longOptions, NULL)) != -1) {
+        switch (option) {
+            case 't':
+                tracePath = optarg;
+                break;
+            case 'g':
+                tracePath = string("gen:") + optarg;
+                break;
+            case 'f':
+                filterPath = optarg;
+                break;
+            case 'i':
+                interactive = true;
+                break;
+            case 'd':
+                debug = true;
+                break;
+            case 's':
+                stats = true;
+                break;
+            case 'I':
+                statsInterval = atoll(optarg);
+                if (statsInterval <= 0) {
+                    printf("Invalid stats interval: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'P':
+                statsPrefix = optarg;
+                break;
+            case 'p':
+                profile = true;
+                break;
+            case 'L':
+                policyOverrides.push_back(optarg);
+                break;
+            case 'O': {
+                std::string error;
+                if (!loadPolicyPlugin(optarg, error)) {
+                    printf("Failed to load policy plugin %s: %s\n", optarg, error.c_str());
+                    return 1;
+                }
+                break;
+            }
+            case 'W':
+                sweepPath = optarg;
+                break;
+            case 'R':
+                resultsPath = optarg;
+                break;
+            case 'j':
+                jobs = atoi(optarg);
+                break;
+            case 'A':
+                analyze = true;
+                break;
+            case 'N':
+                window = parseSize("window", optarg);
+                break;
+            case 'B':
+                lineSize = parseSize("line", optarg);
+                break;
+            case 'E':
+                exact = true;
+                break;
+            case 'C':
+                analysisPath = optarg;
+                break;
+            case 'U':
+                reusePath = optarg;
+                break;
+            case 'H': {
+                std::istringstream names(optarg);
+                string name;
+                while (getline(names, name, ',')) {
+                    if (!name.empty()) shadowPolicies.push_back(name);
+                }
+                break;
+            }
+            case 'S':
+                simpoint = true;
+                break;
+            case 'V':
+                simpointInterval = parseSize("interval", optarg);
+                break;
+            case 'K':
+                clusters = atoi(optarg);
+                break;
+            case 'M':
+                warmup = parseSize("warmup", optarg);
+                break;
+            case 'T':
+                tlbSpec = optarg;
+                break;
+            case 'D':
+                dramSpec = optarg;
+                break;
+            default:
+                printUsage(argv[0]);
+                return 1;
+        }
+    }
+    // --sweep 이면 명세의 모든 조합을 스레드 풀에서 돌리고 결과 파일에 덧붙임
+    if (sweepPath != NULL) {
+        runSweep(sweepPath, resultsPath, jobs);
+        return 0;
+    }
+    // --analyze 이면 시뮬레이션 없이 트레이스의 특성만 측정
+    if (analyze) {
+        TraceReader* trace = tracePath.empty() ? NULL : new TraceReader(tracePath);
+        CompactTraceReader* compact = trace == NULL && isCompactTrace(stdin) ? new CompactTraceReader(stdin) : NULL;
+        TraceAnalyzer analyzer(lineSize, window, exact);
+        while (true) {
+            Access access = trace != NULL ? trace->next()
+                : compact != NULL ? compact->next() : getNextAddress();
+            if (access.accessType == -1) break;
+            analyzer.record(access);
+        }
+        analyzer.finish();
+        analyzer.report();
+        if (analysisPath != NULL) analyzer.writeWindowsCsv(analysisPath);
+        delete trace;
+        delete compact;
+        return 0;
+    }
+    if (optind >= argc) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (simpoint && (tracePath.empty() || interactive || debug || stats || profile || filterPath != NULL
+        || reusePath != NULL || !shadowPolicies.empty() || tlbSpec != NULL || dramSpec != NULL)) {
+        printf("--simpoint needs -t or -g (the trace is read twice) and none of -i, -d, -s, -p, -f, --reuse, --shadow, --tlb, --dram\n");
+        return 1;
+    }
+    if (interactive && debug) {
+        printf("-i and -d options are not supported together\n");
+        return 1;
+    }
+    if (reusePath != NULL && (tracePath.empty() || interactive || tlbSpec != NULL || dramSpec != NULL)) {
+        printf("--reuse needs -t or -g (a trace on stdin cannot be identified before it is read) and none of -i, --tlb, --dram\n");
+        return 1;
+    }
+    if (dramSpec != NULL && !shadowPolicies.empty()) {
+        printf("--dram and --shadow are not supported together (every shadow policy has its own miss stream)\n");
+        return 1;
     }
-    #endif
 
-    // 실행 시간 측정을 위한 시작 시간 기록
-    auto start = high_resolution_clock::now();
+    // 입력 파일로부터 캐시 설정을 읽고, --policy <level>=<policy> 로 레벨별 정책을 바꿈
+    vector<LevelConfig> config = readConfig(argv[optind]);
+    for (size_t i = 0; i < policyOverrides.size(); i++) {
+        size_t separator = policyOverrides[i].find('=');
+        int level = separator == string::npos ? 0 : atoi(policyOverrides[i].substr(0, separator).c_str());
+        if (level < 1 || level > (int)config.size() || separator + 1 == policyOverrides[i].size()) {
+            printf("Invalid policy override: %s (expected <level>=<policy>, level 1-%zu)\n",
+                policyOverrides[i].c_str(), config.size());
+            return 1;
+        }
+        config[level - 1].policy = policyOverrides[i].substr(separator + 1);
+    }
+    // --shadow 는 마지막 레벨을 계층에서 빼므로 그 위에 레벨이 하나 이상 있어야 함
+    if (!shadowPolicies.empty() && config.size() < 2) {
+        printf("--shadow needs a configuration with at least 2 levels (the last level is shadowed)\n");
+        return 1;
+    }
 
-    // 메모리 접근을 시뮬레이션
-    // Write-Through Policy
-    while (true) {
-        // 다음 메모리 주소를 읽어옴 (주소가 -1이면 EOF)
-        Access access = getNextAddress();
-        char accesType = access.accessType;
-        ll address = access.address;
-        // eof
-        if (accesType == -1) break;
+    // --simpoint 이면 대표 구간만 시뮬레이션하고 가중 합으로 전체를 추정
+    if (simpoint) {
+        runSimPoint(config, tracePath, simpointInterval, clusters, warmup);
+        return 0;
+    }
+
+    // --reuse <dir>: 위쪽 레벨들의 미스 스트림이 저장되어 있으면 그 아래 레벨만 시뮬레이션함
+    // (마지막 레벨은 -f, -s 등을 위해 항상 다시 돌림. 그 미스 스트림만 읽으므로 빠름)
+    MissStreamStore* store = NULL;
+    int reused = 0;
+    vector<LevelResult> reusedResults;
+    if (reusePath != NULL) {
+        store = new MissStreamStore(reusePath, tracePath);
+        // 계층에 적어도 한 레벨은 남김 (--shadow 의 마지막 레벨은 계층 밖)
+        reused = store->findDeepest(config, config.size() - (shadowPolicies.empty() ? 1 : 2), reusedResults);
+        if (reused > 0) {
+            tracePath = store->getStreamPath(config, reused);
+        }
+    }
+
+    // --shadow 이면 마지막 레벨은 계층 대신 ShadowCache가 정책마다 시뮬레이션함
+    // 위쪽 레벨들은 모든 정책에 공통이므로 한 번만 돌림
+    int simulatedEnd = config.size() - (shadowPolicies.empty() ? 0 : 1);
+    ShadowCache* shadow = shadowPolicies.empty() ? NULL : new ShadowCache(config.back(), shadowPolicies, config.size());
+    TLB* tlb = tlbSpec != NULL ? new TLB(tlbSpec) : NULL;
+    DRAM* dram = dramSpec != NULL ? new DRAM(dramSpec) : NULL;
+
+    // 캐시 계층을 생성하고 실행 시간 모드를 켬
+    Hierarchy hierarchy(vector<LevelConfig>(config.begin() + reused, config.begin() + simulatedEnd), reused);
+    int levels = hierarchy.getLevels();
+    if (stats) hierarchy.enableStats(statsInterval);
+    if (debug) hierarchy.enableDebug();
+    if (profile) hierarchy.enableProfile();
 
-        // 모든 캐시 레벨을 순회하며 데이터 찾기 시도
+    // stdin이 compact 트레이스(-f 로 만든 미스 스트림)면 바이너리로 읽음
+    TraceReader* trace = tracePath.empty() ? NULL : new TraceReader(tracePath);
+    CompactTraceReader* compact = NULL;
+    if (trace == NULL && isCompactTrace(stdin)) {
+        compact = new CompactTraceReader(stdin);
+    }
+    CompactTraceReader* header = compact != NULL ? compact : trace != NULL ? trace->getCompactReader() : NULL;
+
+    CompactTraceWriter* filter = NULL;
+    if (filterPath != NULL) {
+        string description;
         for (int levelItr = 0; levelItr < levels; levelItr++) {
-            // 해당 주소가 현재 캐시에 있는지 확인
-            ll block = cache[levelItr]->getBlockPosition(address);
-
-            if (block == -1) { // 캐시 미스 발생
-                cache[levelItr]->incMisses(); // 미스 카운트 증가
-                ll blockToReplace = cache[levelItr]->getBlockToReplace(address); // 교체할 블록 선택
-                cache[levelItr]->insert(address, blockToReplace); // 새로운 블록 삽입
-                
-                // UpgradedLRU인지 확인 후 Access 타입으로 insert 호출
-                if (policy == "upgradedLRU") {
-                    static_cast<UpgradedLRU*>(cache[levelItr])->insert(access, blockToReplace);
-                } else {
-                    cache[levelItr]->insert(address, blockToReplace);
-                }
+            description += (levelItr ? "; " : "") + describeLevel(hierarchy.getConfig(levelItr));
+        }
+        filter = new CompactTraceWriter(filterPath, description);
+    }
 
-                cache[levelItr]->update(blockToReplace, 0); // 교체 정책 업데이트 (0 = 미스)
-
-                #if INTERACTIVE
-                printTraceInfo(); // 현재 접근 정보 출력
-                printCacheStatus(cache[levelItr]); // 현재 캐시 상태 출력
-                #endif
-            } else { // 캐시 히트 발생
-                cache[levelItr]->incHits(); // 히트 카운트 증가
-                cache[levelItr]->update(block, 1); // 교체 정책 업데이트 (1 = 히트)
-
-                #if INTERACTIVE
-                printTraceInfo(); // 현재 접근 정보 출력
-                printCacheStatus(cache[levelItr]); // 현재 캐시 상태 출력
-                #endif
-                break; // 캐시 히트가 발생하면 더 이상 다른 레벨을 검사하지 않음
-            }
+    // INTERACTIVE 모드에서는 렌더 스레드가 curses 화면을 그림
+    Dashboard* dashboard = NULL;
+    if (interactive) {
+        vector<Cache*> shown;
+        for (int levelItr = 0; levelItr < levels; levelItr++) {
+            shown.push_back(hierarchy.getCache(levelItr));
+        }
+        for (int policy = 0; shadow != NULL && policy < shadow->getPolicies(); policy++) {
+            shown.push_back(shadow->getCache(policy));
         }
+        dashboard = new Dashboard(shown);
+        dashboard->start();
+    }
+
+    if (profile) hierarchy.getProfiler()->start();
+
+    // 실행 시간 측정을 위한 시작 시간 기록
+    auto start = high_resolution_clock::now();
+
+    Simulation simulation = {&hierarchy, trace, compact, filter, vector<CompactTraceWriter*>(), shadow, dashboard, tlb, dram};
+    // 아직 저장되지 않은 깊이의 미스 스트림을 함께 기록
+    for (int levelItr = 0; store != NULL && levelItr < levels; levelItr++) {
+        simulation.streams.push_back(store->create(config, reused + levelItr + 1));
     }
+    if (interactive) simulateWithStats<true>(simulation, stats, debug, profile);
+    else simulateWithStats<false>(simulation, stats, debug, profile);
+    if (dram != NULL) dram->finish();
 
     // 실행 시간 측정을 위한 종료 시간 기록
     auto stop = high_resolution_clock::now();
     auto duration = duration_cast<std::chrono::milliseconds>(stop - start);
 
-    #if INTERACTIVE
-    usleep(2000000); // 2초 대기
-    endwin(); // curses 세션 종료
-    #endif
+    if (profile) hierarchy.getProfiler()->stop();
+
+    if (interactive) {
+        dashboard->stop(); // 마지막 값으로 한 번 더 그림
+        usleep(2000000); // 2초 대기
+        dashboard->close();
+    }
+
+    // 트레이스 자체의 읽기/쓰기 수 (page walk 참조도 계층을 지나며 읽기로 세어지므로 뺌, TLB 보고에 따로 나옴)
+    ll traceReads = hierarchy.getReads() - (tlb != NULL ? tlb->getWalkReferences() : 0);
+    ll traceWrites = hierarchy.getWrites();
+    // 미스 스트림의 원본 트레이스 읽기/쓰기 수
+    ll sourceReads = header != NULL ? header->getSourceReads() : traceReads;
+    ll sourceWrites = header != NULL ? header->getSourceWrites() : traceWrites;
 
     // 최종 결과 출력
-    printTraceInfo2(); // 최종 접근 통계 정보 출력
+    // 최종 접근 통계 정보 출력 (--reuse 로 저장된 스트림을 읽었으면 그 스트림이 아닌 원본 트레이스의 수)
+    if (reused > 0) printTraceInfo2(sourceReads, sourceWrites);
+    else printTraceInfo2(traceReads, traceWrites);
+    if (header != NULL) {
+        printf("Miss stream of [%s] over %lld accesses (%lld reads, %lld writes)\n\n",
+            header->getDescription().c_str(), sourceReads + sourceWrites, sourceReads, sourceWrites);
+    }
+    if (filter != NULL) {
+        printf("Miss stream: %lld accesses written to %s\n\n", filter->getRecords(), filterPath);
+        filter->close(sourceReads, sourceWrites);
+    }
+    if (store != NULL) {
+        printf("Reused %d of %zu levels from %s, simulated %d\n\n", reused, config.size(), reusePath, levels);
+        // 이번에 지나간 레벨들의 스트림을 위쪽 레벨들의 결과와 함께 저장
+        vector<LevelResult> results = reusedResults;
+        for (int levelItr = 0; levelItr < levels; levelItr++) {
+            Cache* cache = hierarchy.getCache(levelItr);
+            string policy = cache->getPolicy();
+            results.push_back({cache->getLevel(), policy.substr(0, policy.find_last_not_of(' ') + 1),
+                cache->getHits(), cache->getMisses(), cache->getMemAccs()});
+            store->commit(config, reused + levelItr + 1, simulation.streams[levelItr], sourceReads, sourceWrites, results);
+            delete simulation.streams[levelItr];
+        }
+    }
+    for (size_t levelItr = 0; levelItr < reusedResults.size(); levelItr++) {
+        printReusedLevelStatus(reusedResults[levelItr]);
+    }
     for (int levelItr = 0; levelItr < levels; levelItr++) {
-        printCacheStatus2(cache[levelItr], duration); // 각 캐시 레벨의 상태와 실행 시간 출력
-        delete cache[levelItr]; // 동적으로 생성한 캐시 객체 삭제
+        printCacheStatus2(hierarchy.getCache(levelItr), duration); // 각 캐시 레벨의 상태와 실행 시간 출력
+        if (NUCACache* nuca = dynamic_cast<NUCACache*>(hierarchy.getCache(levelItr))) {
+            printNUCAStatus(nuca);
+        }
+        if (hierarchy.getVictimCache(levelItr) != NULL) {
+            printVictimCacheStatus(hierarchy.getVictimCache(levelItr));
+        }
+        if (hierarchy.getMSHR(levelItr) != NULL) {
+            printMSHRStatus(hierarchy.getMSHR(levelItr));
+        }
     }
 
+    if (tlb != NULL) {
+        printTLBStatus(tlb, levels);
+    }
+    if (dram != NULL) {
+        dram->report();
+    }
+
+    if (shadow != NULL) {
+        for (int policy = 0; policy < shadow->getPolicies(); policy++) {
+            printCacheStatus2(shadow->getCache(policy), duration);
+        }
+        printShadowSummary(shadow);
+    }
+
+    if (profile) hierarchy.getProfiler()->report(duration.count());
+
+    // 통계를 CSV/JSON으로 저장
+    if (stats) hierarchy.dumpStats(statsPrefix);
+
+    delete trace;
+    delete compact;
+    delete filter;
+    delete store;
+    delete shadow;
+    delete tlb;
+    delete dram;
+    delete dashboard;
+
     return 0; // 프로그램 종료
 }
 
+int main(int argc, char *argv[]){
+    // 라이브러리는 잘못된 설정이나 트레이스에 예외를 던지고, 여기서 메시지를 출력하고 종료
+    try {
+        return run(argc, argv);
+    } catch(const exception& error){
+        printf("%s\n", error.what());
+        return 1;
+    }
+}
@@ -0,0 +1,131 @@
+#include "missStreamStore.h"
+#include <errno.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define ll long long
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+static unsigned long long fnv1a(unsigned long long hash, const unsigned char* data, size_t length){
+    for(size_t i = 0; i < length; i++){
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// 파일 내용의 해시 (gzip이면 압축된 바이트 그대로)
+static unsigned long long hashFile(const std::string& path, const char* kind){
+    unsigned long long hash = FNV_OFFSET;
+    FILE* in = fopen(path.c_str(), "rb");
+    if(in == NULL){
+        throw std::runtime_error("Failed to open " + std::string(kind) + " " + path);
+    }
+    std::vector<unsigned char> buffer(1 << 20);
+    size_t length;
+    while((length = fread(buffer.data(), 1, buffer.size(), in)) > 0){
+        hash = fnv1a(hash, buffer.data(), length);
+    }
+    fclose(in);
+    return hash;
+}
+
+static unsigned long long hashTrace(const std::string& trace){
+    if(trace.compare(0, 4, "gen:") == 0){
+        return fnv1a(FNV_OFFSET, (const unsigned char*)trace.data(), trace.size());
+    }
+    return hashFile(trace, "trace");
+}
+
+MissStreamStore::MissStreamStore(const std::string& directory, const std::string& trace){
+    this->directory = directory;
+    if(mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST){
+        throw std::runtime_error("Failed to create " + directory);
+    }
+    traceHash = hashTrace(trace);
+}
+
+std::string MissStreamStore::getPath(const std::vector<LevelConfig>& config, int levels, const char* extension){
+    std::ostringstream key;
+    key << std::hex << traceHash;
+    for(int level = 0; level < levels; level++){
+        key << "\n" << describeLevel(config[level]);
+        // describeLevel 에는 플러그인 경로만 있으므로 다시 빌드한 플러그인은 내용으로 구분함
+        if(config[level].hasOption("plugin")){
+            std::string plugin = config[level].getOption("plugin", "");
+            if(!pluginHashes.count(plugin)) pluginHashes[plugin] = hashFile(plugin, "policy plugin");
+            key << " " << pluginHashes[plugin];
+        }
+    }
+    std::string text = key.str();
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx", fnv1a(FNV_OFFSET, (const unsigned char*)text.data(), text.size()));
+    return directory + "/" + name + extension;
+}
+
+// 결과 파일이 없거나 levels 개 레벨의 결과가 아니면 false
+bool MissStreamStore::readResults(const std::vector<LevelConfig>& config, int levels, std::vector<LevelResult>& results){
+    std::ifstream in(getPath(config, levels, ".levels").c_str());
+    results.clear();
+    LevelResult result;
+    while(in >> result.level >> result.policy >> result.hits >> result.misses >> result.memAccs){
+        if(result.level != (int)results.size() + 1) return false;
+        results.push_back(result);
+    }
+    return in.eof() && (int)results.size() == levels;
+}
+
+int MissStreamStore::findDeepest(const std::vector<LevelConfig>& config, int maxLevels, std::vector<LevelResult>& results){
+    for(int levels = maxLevels; levels > 0; levels--){
+        if(access(getPath(config, levels, ".csim").c_str(), R_OK) == 0 && readResults(config, levels, results)){
+            return levels;
+        }
+    }
+    results.clear();
+    return 0;
+}
+
+std::string MissStreamStore::getStreamPath(const std::vector<LevelConfig>& config, int levels){
+    return getPath(config, levels, ".csim");
+}
+
+CompactTraceWriter* MissStreamStore::create(const std::vector<LevelConfig>& config, int levels){
+    std::string description;
+    for(int level = 0; level < levels; level++){
+        description += (level ? "; " : "") + describeLevel(config[level]);
+    }
+    std::string path = getPath(config, levels, ".csim") + "." + std::to_string(getpid()) + ".tmp";
+    return new CompactTraceWriter(path.c_str(), description);
+}
+
+void MissStreamStore::commit(const std::vector<LevelConfig>& config, int levels, CompactTraceWriter* writer,
+    ll sourceReads, ll sourceWrites, const std::vector<LevelResult>& results){
+    writer->close(sourceReads, sourceWrites);
+
+    std::string stream = getPath(config, levels, ".csim");
+    std::string temporary = stream + "." + std::to_string(getpid()) + ".tmp";
+    std::string resultsPath = getPath(config, levels, ".levels");
+    std::string resultsTemporary = resultsPath + "." + std::to_string(getpid()) + ".tmp";
+    FILE* out = fopen(resultsTemporary.c_str(), "w");
+    if(out == NULL){
+        printf("Failed to write %s\n", resultsPath.c_str());
+        remove(temporary.c_str());
+        return;
+    }
+    for(size_t i = 0; i < results.size(); i++){
+        fprintf(out, "%d %s %lld %lld %lld\n", results[i].level, results[i].policy.c_str(),
+            results[i].hits, results[i].misses, results[i].memAccs);
+    }
+    fclose(out);
+    // 결과를 먼저 옮기고 스트림을 옮김: 스트림이 있으면 결과도 있음
+    rename(resultsTemporary.c_str(), resultsPath.c_str());
+    rename(temporary.c_str(), stream.c_str());
+}
+
+unsigned long long MissStreamStore::getTraceHash(){
+    return traceHash;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include "config.h"
+#include "compactTrace.h"
+
+#define ll long long
+
+// 저장된 미스 스트림을 만든 레벨의 결과
+struct LevelResult {
+    int level; // L1 = 1
+    std::string policy;
+    ll hits, misses, memAccs;
+};
+
+// 레벨별 미스 스트림 저장소 (--reuse <dir>)
+// 트레이스와 위쪽 k개 레벨의 설정이 같으면 그 k개 레벨을 지나 내려가는 접근들도 같으므로,
+// 한 번 시뮬레이션할 때 레벨마다 내려가는 스트림을 compact 트레이스로 저장해 두고
+// 다음에는 바뀐 레벨부터 시뮬레이션함.
+//   <dir>/<key>.csim    위쪽 k개 레벨에서 모두 미스난 접근 (헤더에 원본의 읽기/쓰기 수)
+//   <dir>/<key>.levels  그 k개 레벨의 결과 (level policy hits misses memAccs)
+// key는 트레이스 내용의 해시와 위쪽 k개 레벨의 describeLevel (플러그인이면 .so 내용의 해시도) 로 만듦.
+class MissStreamStore{
+
+    private:
+        std::string directory;
+        unsigned long long traceHash;
+        std::map<std::string, unsigned long long> pluginHashes; // 플러그인 경로 -> 내용의 해시
+
+        std::string getPath(const std::vector<LevelConfig>& config, int levels, const char* extension);
+        bool readResults(const std::vector<LevelConfig>& config, int levels, std::vector<LevelResult>& results);
+
+    public:
+        // trace 는 TraceReader 가 여는 경로 (gen:<spec> 이면 spec 으로 해시)
+        MissStreamStore(const std::string& directory, const std::string& trace);
+
+        // 위쪽 levels 개 레벨을 지난 스트림이 저장된 가장 깊은 levels (maxLevels 이하, 없으면 0)
+        // 그 레벨들의 결과를 results 에 채움. 결과 파일이 깨졌으면 저장되지 않은 것으로 봄
+        int findDeepest(const std::vector<LevelConfig>& config, int maxLevels, std::vector<LevelResult>& results);
+
+        std::string getStreamPath(const std::vector<LevelConfig>& config, int levels);
+
+        // 위쪽 levels 개 레벨을 지난 스트림을 임시 파일로 쓰기 시작함
+        CompactTraceWriter* create(const std::vector<LevelConfig>& config, int levels);
+        // 스트림을 닫고 결과와 함께 제 이름으로 옮김 (중간에 끊긴 스트림은 남지 않음)
+        void commit(const std::vector<LevelConfig>& config, int levels, CompactTraceWriter* writer,
+            ll sourceReads, ll sourceWrites, const std::vector<LevelResult>& results);
+
+        unsigned long long getTraceHash();
+};
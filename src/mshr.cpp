@@ -0,0 +1,68 @@
+#include "mshr.h"
+
+#define ll long long
+
+MSHR::MSHR(ll entries, ll latency){
+    this->entries = entries;
+    this->latency = latency;
+    lines.assign(this->entries, -1);
+    readyAt.assign(this->entries, 0);
+    primaryMisses = 0;
+    delayedHits = 0;
+    stalls = 0;
+    stallAccesses = 0;
+}
+
+bool MSHR::hit(ll lineAddress, ll now){
+    for(ll entry = 0; entry < entries; entry++){
+        if(lines[entry] == lineAddress && readyAt[entry] > now){
+            delayedHits++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void MSHR::miss(ll lineAddress, ll now){
+    primaryMisses++;
+
+    // 가장 먼저 비는 엔트리를 사용 (이미 비어 있으면 바로)
+    ll earliest = 0;
+    for(ll entry = 0; entry < entries; entry++){
+        if(readyAt[entry] < readyAt[earliest]){
+            earliest = entry;
+        }
+    }
+    ll issue = now;
+    if(readyAt[earliest] > now){
+        stalls++;
+        stallAccesses += readyAt[earliest] - now;
+        issue = readyAt[earliest];
+    }
+    lines[earliest] = lineAddress;
+    readyAt[earliest] = issue + latency;
+}
+
+ll MSHR::getEntries(){
+    return entries;
+}
+
+ll MSHR::getLatency(){
+    return latency;
+}
+
+ll MSHR::getPrimaryMisses(){
+    return primaryMisses;
+}
+
+ll MSHR::getDelayedHits(){
+    return delayedHits;
+}
+
+ll MSHR::getStalls(){
+    return stalls;
+}
+
+ll MSHR::getStallAccesses(){
+    return stallAccesses;
+}
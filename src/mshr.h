@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include "cache.h"
+
+#define ll long long
+
+// 미스 처리 중인 라인을 추적하는 miss status holding register 모델
+// 트레이스 기반이라 사이클이 없으므로 레벨에 들어온 접근 수를 시간으로 사용함.
+// 미스는 latency 접근 동안 엔트리를 차지하고, 그 사이 같은 라인에 대한 히트는
+// 아직 채워지지 않은 라인을 기다리는 secondary miss (delayed hit)로 셈.
+// 점유만 세는 카운터이며 타이밍 모델이 아님: 엔트리가 모두 차도 접근은 늦어지지 않고,
+// stalls 는 엔트리가 더 있었다면 기다리지 않았을 미스의 수와 그 대기 시간을 보여 줌.
+class MSHR{
+
+    private:
+        ll entries;
+        ll latency;
+        std::vector<ll> lines;   // 엔트리별 라인 주소
+        std::vector<ll> readyAt; // 엔트리가 비는 시각
+
+        ll primaryMisses;
+        ll delayedHits;
+        ll stalls;        // 모든 엔트리가 사용 중일 때 온 미스 수
+        ll stallAccesses; // 엔트리가 빌 때까지 남은 시간의 합 (실제로 늦추지는 않음)
+
+    public:
+        // entries, latency 는 양수 (params.cfg 의 값은 Hierarchy 가 검사함)
+        MSHR(ll entries, ll latency);
+
+        // 레벨 히트 시 호출: 같은 라인의 미스가 아직 처리 중이면 true
+        bool hit(ll lineAddress, ll now);
+        // 다음 레벨로 내려가는 미스 시 호출 (victim cache 히트는 제외): 엔트리를 할당
+        void miss(ll lineAddress, ll now);
+
+        ll getEntries();
+        ll getLatency();
+        ll getPrimaryMisses();
+        ll getDelayedHits();
+        ll getStalls();
+        ll getStallAccesses();
+};
@@ -0,0 +1,150 @@
+#include "nuca.h"
+#include <math.h>
+
+#define ll long long
+
+NUCACache::NUCACache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::vector<Cache*>& banks,
+    int sockets, int core, ll hopLatency, ll bankLatency, ll socketLatency) :
+    Cache(cacheSize, blockSize, setAssociativity, level, "NUCA-" + banks[0]->getPolicy(), false){ // 태그는 뱅크에만 있음
+    this->banks = banks;
+    this->bankSets = banks[0]->getNumberOfSets();
+    this->bankBlocks = bankSets * setAssociativity;
+    this->sockets = sockets;
+    this->core = core;
+    this->totalHops = 0;
+    this->totalLatency = 0;
+    bankAccesses.assign(banks.size(), 0);
+
+    // 소켓마다 banksPerSocket 개의 뱅크가 cols x rows mesh로 놓임
+    int banksPerSocket = (banks.size() + this->sockets - 1) / this->sockets;
+    int cols = (int)ceil(sqrt((double)banksPerSocket));
+    int coreSocket = core / banksPerSocket;
+    int coreTile = core % banksPerSocket;
+    for(size_t bank = 0; bank < banks.size(); bank++){
+        int socket = bank / banksPerSocket;
+        int tile = bank % banksPerSocket;
+        ll hops;
+        ll latency = bankLatency;
+        if(socket == coreSocket){
+            hops = abs(tile % cols - coreTile % cols) + abs(tile / cols - coreTile / cols);
+        } else {
+            // 다른 소켓: 소켓 간 링크까지 가고 (0번 타일) 그 소켓 mesh 안에서 이동
+            hops = coreTile % cols + coreTile / cols + tile % cols + tile / cols;
+            latency += socketLatency;
+        }
+        bankHops.push_back(hops);
+        this->bankLatency.push_back(latency + hops * hopLatency);
+    }
+}
+
+// 뱅크 안에서 세트를 고르는 비트 위쪽만 XOR로 접어서 뱅크를 고름
+// (세트 인덱스 비트로 뱅크를 고르면 각 뱅크가 세트의 1/banks 만 쓰게 됨)
+int NUCACache::getBank(ll address){
+    unsigned long long line = ((unsigned long long)address >> offsetSize) / bankSets;
+    unsigned long long hash = 0;
+    for(; line; line >>= 16){
+        hash ^= line & 0xFFFF;
+    }
+    return hash % banks.size();
+}
+
+ll NUCACache::getBlockPosition(ll address){
+    int bank = getBank(address);
+    bankAccesses[bank]++;
+    totalHops += bankHops[bank];
+    totalLatency += bankLatency[bank];
+
+    ll block = banks[bank]->getBlockPosition(address);
+    if(block == -1){
+        banks[bank]->incMisses();
+        return -1;
+    }
+    banks[bank]->incHits();
+    return bank*bankBlocks + block;
+}
+
+ll NUCACache::getBlockToReplace(ll address){
+    int bank = getBank(address);
+    return bank*bankBlocks + banks[bank]->getBlockToReplace(address);
+}
+
+void NUCACache::insert(ll address, ll blockToReplace){
+    incMemAccs();
+    banks[blockToReplace/bankBlocks]->insert(address, blockToReplace%bankBlocks);
+}
+
+void NUCACache::insert(Access access, ll blockToReplace){
+    incMemAccs();
+    banks[blockToReplace/bankBlocks]->insert(access, blockToReplace%bankBlocks);
+}
+
+bool NUCACache::isValidPlacement(ll address, ll block){
+    int bank = getBank(address);
+    return block/bankBlocks == bank && banks[bank]->isValidPlacement(address, block%bankBlocks);
+}
+
+void NUCACache::update(ll block, int status){
+    banks[block/bankBlocks]->update(block%bankBlocks, status);
+}
+
+ll NUCACache::getLineAddress(ll block){
+    return banks[block/bankBlocks]->getLineAddress(block%bankBlocks);
+}
+
+void NUCACache::invalidate(ll block){
+    banks[block/bankBlocks]->invalidate(block%bankBlocks);
+}
+
+void NUCACache::writeTag(ll address, ll blockToReplace){
+    banks[blockToReplace/bankBlocks]->writeTag(address, blockToReplace%bankBlocks);
+}
+
+bool NUCACache::supportsShadow(){
+    return false;
+}
+
+int NUCACache::getBanks(){
+    return banks.size();
+}
+
+Cache* NUCACache::getBankCache(int bank){
+    return banks[bank];
+}
+
+ll NUCACache::getBankAccesses(int bank){
+    return bankAccesses[bank];
+}
+
+ll NUCACache::getBankHops(int bank){
+    return bankHops[bank];
+}
+
+double NUCACache::getLoadImbalance(){
+    ll total = 0, busiest = 0;
+    for(size_t bank = 0; bank < banks.size(); bank++){
+        total += bankAccesses[bank];
+        if(bankAccesses[bank] > busiest) busiest = bankAccesses[bank];
+    }
+    if(total == 0){
+        return 0;
+    }
+    return (double)busiest * banks.size() / total;
+}
+
+double NUCACache::getAverageHops(){
+    ll lookups = 0;
+    for(size_t bank = 0; bank < banks.size(); bank++) lookups += bankAccesses[bank];
+    return lookups == 0 ? 0 : (double)totalHops / lookups;
+}
+
+double NUCACache::getAverageLatency(){
+    ll lookups = 0;
+    for(size_t bank = 0; bank < banks.size(); bank++) lookups += bankAccesses[bank];
+    return lookups == 0 ? 0 : (double)totalLatency / lookups;
+}
+
+NUCACache::~NUCACache(){
+    for(size_t bank = 0; bank < banks.size(); bank++){
+        delete banks[bank];
+    }
+}
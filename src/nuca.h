@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+#include "cache.h"
+
+#define ll long long
+
+// 주소 해시로 뱅크(슬라이스)를 고르는 NUCA 레벨
+// 레벨을 N개의 Cache 인스턴스로 나누고, 블록 번호는 bank*bankBlocks + (뱅크 안의 블록 번호)로 씀.
+// 뱅크는 소켓별 2D mesh에 놓이고, 접근 지연 = bankLatency + hop 수*hopLatency (+ 다른 소켓이면 socketLatency).
+class NUCACache : public Cache{
+
+    private:
+        std::vector<Cache*> banks;
+        ll bankSets;
+        ll bankBlocks;
+        int sockets;
+        int core; // 요청하는 코어가 붙어 있는 타일 번호
+
+        std::vector<ll> bankHops;     // 뱅크별 코어로부터의 hop 수
+        std::vector<ll> bankLatency;  // 뱅크별 접근 지연
+        std::vector<ll> bankAccesses;
+        ll totalHops;
+        ll totalLatency;
+
+        int getBank(ll address);
+
+    public:
+        NUCACache(ll cacheSize, ll blockSize, ll setAssociativity, int level, std::vector<Cache*>& banks,
+            int sockets, int core, ll hopLatency, ll bankLatency, ll socketLatency);
+
+        ll getBlockPosition(ll address) override;
+        ll getBlockToReplace(ll address) override;
+        void insert(ll address, ll blockToReplace) override;
+        void insert(Access access, ll blockToReplace) override;
+        bool isValidPlacement(ll address, ll block) override;
+        void update(ll blockToReplace, int status) override;
+        ll getLineAddress(ll block) override;
+        void invalidate(ll block) override;
+        void writeTag(ll address, ll blockToReplace) override;
+        bool supportsShadow() override; // 태그는 뱅크마다 있으므로 false
+
+        int getBanks();
+        Cache* getBankCache(int bank);
+        ll getBankAccesses(int bank);
+        ll getBankHops(int bank);
+        double getLoadImbalance();     // 최대 뱅크 접근 수 / 평균
+        double getAverageHops();
+        double getAverageLatency();
+
+        ~NUCACache();
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string.h>
+#include "cache.h"
+
+#define ll long long
+
+// 교체 정책 플러그인 ABI
+// 플러그인은 template/ 의 뼈대로 만든 Cache 하위 클래스를 .so 로 빌드한 것이며
+// (make plugin POLICY=<policy.cpp>), params.cfg 의 plugin=<path> 나 --plugin <path> 로 읽힘.
+// Cache 객체를 그대로 주고받으므로 플러그인은 같은 cache.h 로 빌드되어야 함.
+// Cache의 멤버나 가상 함수가 바뀌면 CACHESIM_PLUGIN_ABI 를 올려 예전 플러그인을 거부함.
+// 2: supportsShadow() 추가, PolicyFactory 에 allocateTags 추가
+#define CACHESIM_PLUGIN_ABI 2
+
+namespace {
+
+// Cache 가상 함수들의 vtable 슬롯으로 만든 값 (sizeof 로는 가상 함수 변화를 알 수 없음)
+// Itanium C++ ABI(gcc, clang)에서 가상 멤버 함수 포인터의 첫 워드는 1 + vtable 안의 오프셋이라
+// 가상 함수가 끼어들거나 빠지거나 순서가 바뀌면 값이 달라짐. Cache 에 가상 함수를 추가하면 여기에도 추가.
+// 익명 namespace 라 플러그인과 시뮬레이터가 각자 자기가 본 cache.h 로 계산함
+struct CacheLayout : Cache{
+    template <class Method>
+    static unsigned long slot(Method method){
+        unsigned long word;
+        memcpy(&word, &method, sizeof(word));
+        return word;
+    }
+
+    static unsigned long get(){
+        unsigned long slots[] = {
+            slot(&Cache::getLineAddress), slot(&Cache::invalidate), slot(&Cache::getBlockPosition),
+            slot(static_cast<void (Cache::*)(ll, ll)>(&Cache::insert)),
+            slot(static_cast<void (Cache::*)(Access, ll)>(&Cache::insert)),
+            slot(&Cache::writeTag), slot(&Cache::isValidPlacement), slot(&Cache::getBlockToReplace),
+            slot(&Cache::update), slot(&Cache::supportsShadow), slot(&CacheLayout::supportsSkew)
+        };
+        unsigned long hash = sizeof(Cache);
+        for(size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++){
+            hash = hash * 1000003 ^ slots[i];
+        }
+        return hash;
+    }
+};
+
+}
+
+// 정책 생성 함수 (allocateTags 가 false 면 태그 배열 없이 만듦: --shadow 가 태그를 따로 가짐)
+typedef Cache* (*PolicyFactory)(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags);
+// 플러그인이 정책을 등록할 때 부르는 함수 (시뮬레이터가 넘겨줌)
+typedef void (*PolicyRegistrar)(const char* name, PolicyFactory factory);
+
+// 플러그인이 내보내는 C 함수들
+//   int cachesimPluginAbi()                                  빌드할 때의 CACHESIM_PLUGIN_ABI
+//   unsigned long cachesimCacheSize()                        빌드할 때의 sizeof(Cache)
+//   unsigned long cachesimCacheLayout()                      빌드할 때의 CacheLayout::get()
+//   void cachesimRegisterPolicies(PolicyRegistrar registrar) 정책들을 이름으로 등록
+// 정책 하나짜리 플러그인은 .cpp 끝에 CACHESIM_POLICY_PLUGIN("<name>", <CLASS>) 한 줄이면 됨.
+// CLASS 의 생성자는 (cacheSize, blockSize, setAssociativity, level, allocateTags) 를 받아 allocateTags 를 Cache 에 넘김.
+#define CACHESIM_PLUGIN_EXPORTS \
+    extern "C" int cachesimPluginAbi(){ return CACHESIM_PLUGIN_ABI; } \
+    extern "C" unsigned long cachesimCacheSize(){ return sizeof(Cache); } \
+    extern "C" unsigned long cachesimCacheLayout(){ return CacheLayout::get(); }
+
+#define CACHESIM_POLICY_PLUGIN(NAME, CLASS) \
+    CACHESIM_PLUGIN_EXPORTS \
+    static Cache* createPluginPolicy(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags){ \
+        return new CLASS(cacheSize, blockSize, setAssociativity, level, allocateTags); \
+    } \
+    extern "C" void cachesimRegisterPolicies(PolicyRegistrar registrar){ registrar(NAME, createPluginPolicy); }
@@ -0,0 +1,112 @@
+#include "policyRegistry.h"
+#include <dlfcn.h>
+#include <map>
+#include <mutex>
+#include <set>
+#include "../policies/plru.h"
+#include "../policies/lru.h"
+#include "../policies/srrip.h"
+#include "../policies/nru.h"
+#include "../policies/lfu.h"
+#include "../policies/fifo.h"
+#include "../policies/upgradedLRU.h"
+
+#define ll long long
+
+static std::mutex registryLock;
+static std::map<std::string, PolicyFactory> registry;
+static std::set<std::string> loadedPlugins;
+static bool builtinsRegistered = false;
+
+// 새 내장 정책은 여기에 한 줄 추가
+static void registerBuiltinPolicies(){
+    registry["plru"] = [](ll cs, ll bs, ll sa, int level, bool tags) -> Cache* { return new PLRU(cs, bs, sa, level, tags); };
+    registry["lru"] = [](ll cs, ll bs, ll sa, int level, bool tags) -> Cache* { return new LRU(cs, bs, sa, level, tags); };
+    registry["srrip"] = [](ll cs, ll bs, ll sa, int level, bool tags) -> Cache* { return new SRRIP(cs, bs, sa, level, tags); };
+    registry["nru"] = [](ll cs, ll bs, ll sa, int level, bool tags) -> Cache* { return new NRU(cs, bs, sa, level, tags); };
+    registry["lfu"] = [](ll cs, ll bs, ll sa, int level, bool tags) -> Cache* { return new LFU(cs, bs, sa, level, tags); };
+    registry["fifo"] = [](ll cs, ll bs, ll sa, int level, bool tags) -> Cache* { return new FIFO(cs, bs, sa, level, tags); };
+    registry["upgradedLRU"] = [](ll cs, ll bs, ll sa, int level, bool) -> Cache* { return new UpgradedLRU(cs, bs, sa, level, 16); };
+    builtinsRegistered = true;
+}
+
+// registryLock 을 잡은 상태에서 호출
+static void ensureBuiltins(){
+    if(!builtinsRegistered) registerBuiltinPolicies();
+}
+
+// 플러그인의 cachesimRegisterPolicies 가 부름 (loadPolicyPlugin 이 락을 잡고 있음)
+static void registerLocked(const char* name, PolicyFactory factory){
+    registry[name] = factory;
+}
+
+void registerPolicy(const std::string& name, PolicyFactory factory){
+    std::lock_guard<std::mutex> guard(registryLock);
+    ensureBuiltins();
+    registry[name] = factory;
+}
+
+Cache* createPolicy(const std::string& name, ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags){
+    PolicyFactory factory;
+    {
+        std::lock_guard<std::mutex> guard(registryLock);
+        ensureBuiltins();
+        std::map<std::string, PolicyFactory>::iterator it = registry.find(name);
+        if(it == registry.end()) return NULL;
+        factory = it->second;
+    }
+    return factory(cacheSize, blockSize, setAssociativity, level, allocateTags);
+}
+
+std::vector<std::string> getPolicyNames(){
+    std::lock_guard<std::mutex> guard(registryLock);
+    ensureBuiltins();
+    std::vector<std::string> names;
+    for(std::map<std::string, PolicyFactory>::iterator it = registry.begin(); it != registry.end(); it++){
+        names.push_back(it->first);
+    }
+    return names;
+}
+
+bool loadPolicyPlugin(const std::string& path, std::string& error){
+    std::lock_guard<std::mutex> guard(registryLock);
+    ensureBuiltins();
+    if(loadedPlugins.count(path)) return true;
+
+    // 플러그인은 프로세스가 끝날 때까지 닫지 않음 (정책 객체의 코드가 그 안에 있음)
+    // 경로에 / 가 없으면 dlopen이 라이브러리 검색 경로를 뒤지므로 현재 디렉터리 기준으로 바꿈
+    std::string file = path.find('/') == std::string::npos ? "./" + path : path;
+    void* handle = dlopen(file.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if(handle == NULL){
+        error = dlerror();
+        return false;
+    }
+
+    typedef int (*AbiFunction)();
+    typedef unsigned long (*SizeFunction)();
+    typedef void (*RegisterFunction)(PolicyRegistrar);
+    AbiFunction abi = (AbiFunction)dlsym(handle, "cachesimPluginAbi");
+    SizeFunction cacheSize = (SizeFunction)dlsym(handle, "cachesimCacheSize");
+    RegisterFunction registerPolicies = (RegisterFunction)dlsym(handle, "cachesimRegisterPolicies");
+    if(abi == NULL || cacheSize == NULL || registerPolicies == NULL){
+        error = "not a cacheSim policy plugin (missing cachesimPluginAbi, cachesimCacheSize or cachesimRegisterPolicies)";
+        dlclose(handle);
+        return false;
+    }
+    if(abi() != CACHESIM_PLUGIN_ABI){
+        error = "built against an incompatible cache.h (plugin ABI " + std::to_string(abi()) + ", simulator ABI "
+            + std::to_string(CACHESIM_PLUGIN_ABI) + "); rebuild it";
+        dlclose(handle);
+        return false;
+    }
+    // ABI 번호를 올리지 않고 Cache 를 바꾼 경우도 잡음 (ABI 1 플러그인에는 cachesimCacheLayout 이 없음)
+    SizeFunction layout = (SizeFunction)dlsym(handle, "cachesimCacheLayout");
+    if(cacheSize() != sizeof(Cache) || layout == NULL || layout() != CacheLayout::get()){
+        error = "built against a cache.h whose Cache members or virtual functions differ from the simulator's; rebuild it";
+        dlclose(handle);
+        return false;
+    }
+    registerPolicies(registerLocked);
+    loadedPlugins.insert(path);
+    return true;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "cache.h"
+#include "policyPlugin.h"
+
+#define ll long long
+
+// 이름 -> 교체 정책 생성 함수
+// 내장 정책(policies/)은 처음 찾을 때 등록되고, 플러그인 정책은 loadPolicyPlugin 으로 추가됨.
+// 여러 스레드에서 동시에 찾아도 됨 (sweep).
+
+// 같은 이름이 이미 있으면 새 생성 함수로 바꿈
+void registerPolicy(const std::string& name, PolicyFactory factory);
+
+// 등록된 정책으로 캐시를 생성 (없는 이름이면 NULL, allocateTags 는 PolicyFactory 참고)
+Cache* createPolicy(const std::string& name, ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags);
+
+// 등록된 정책 이름들 (이름 순)
+std::vector<std::string> getPolicyNames();
+
+// .so 를 dlopen 하고 정책들을 등록함 (같은 경로는 한 번만 읽음).
+// 실패하면 false 와 이유를 반환
+bool loadPolicyPlugin(const std::string& path, std::string& error);
@@ -0,0 +1,145 @@
+#include "profiler.h"
+#include <map>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#define ll long long
+
+static const char* phaseNames[NUM_PHASES] = {"ingest", "lookup", "victim", "insert", "update"};
+
+#ifdef __linux__
+static const unsigned long long perfConfigs[4] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+#endif
+static const char* perfNames[4] = {"cycles", "instructions", "cache-misses", "branch-misses"};
+
+Profiler::Profiler(std::vector<Cache*>& cache){
+    levels = cache.size();
+    for(int level = 0; level < levels; level++){
+        policies.push_back(cache[level]->getPolicy());
+        numbers.push_back(cache[level]->getLevel());
+    }
+    cycles.assign(levels * NUM_PHASES, 0);
+    calls.assign(levels * NUM_PHASES, 0);
+    loopStart = 0;
+    loopCycles = 0;
+
+    for(int i = 0; i < 4; i++){
+        perfFds[i] = -1;
+        perfValues[i] = -1;
+    }
+    #ifdef __linux__
+    // 권한이 없으면 (perf_event_paranoid) 해당 카운터는 건너뜀
+    for(int i = 0; i < 4; i++){
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = perfConfigs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        perfFds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+    #endif
+}
+
+void Profiler::start(){
+    #ifdef __linux__
+    for(int i = 0; i < 4; i++){
+        if(perfFds[i] != -1){
+            ioctl(perfFds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(perfFds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    #endif
+    loopStart = readTsc();
+}
+
+void Profiler::stop(){
+    loopCycles = readTsc() - loopStart;
+    #ifdef __linux__
+    for(int i = 0; i < 4; i++){
+        if(perfFds[i] != -1){
+            ioctl(perfFds[i], PERF_EVENT_IOC_DISABLE, 0);
+            if(read(perfFds[i], &perfValues[i], sizeof(perfValues[i])) != sizeof(perfValues[i])){
+                perfValues[i] = -1;
+            }
+        }
+    }
+    #endif
+}
+
+void Profiler::report(ll durationMs){
+    printf("Profile (TSC ticks)\n");
+    printf("%-6s %-12s %-8s %16s %14s %10s %7s\n", "Level", "Policy", "Phase", "Ticks", "Calls", "Ticks/call", "Share");
+
+    unsigned long long accounted = 0;
+    std::map<std::string, std::vector<unsigned long long> > policyCycles;
+    std::map<std::string, std::vector<ll> > policyCalls;
+    for(int level = 0; level < levels; level++){
+        std::vector<unsigned long long>& pc = policyCycles[policies[level]];
+        std::vector<ll>& pn = policyCalls[policies[level]];
+        pc.resize(NUM_PHASES, 0);
+        pn.resize(NUM_PHASES, 0);
+        for(int phase = 0; phase < NUM_PHASES; phase++){
+            unsigned long long c = cycles[level*NUM_PHASES + phase];
+            ll n = calls[level*NUM_PHASES + phase];
+            accounted += c;
+            if(n == 0) continue;
+            if(phase != PHASE_INGEST){
+                pc[phase] += c;
+                pn[phase] += n;
+            }
+            printf("%-6s %-12s %-8s %16llu %14lld %10.1f %6.2f%%\n",
+                phase == PHASE_INGEST ? "-" : ("L" + std::to_string(numbers[level])).c_str(),
+                phase == PHASE_INGEST ? "-" : policies[level].c_str(),
+                phaseNames[phase], c, n, (double)c/n,
+                loopCycles ? 100.0*c/loopCycles : 0.0);
+        }
+    }
+    if(loopCycles > accounted){
+        printf("%-6s %-12s %-8s %16llu %14s %10s %6.2f%%\n", "-", "-", "other",
+            loopCycles - accounted, "-", "-", 100.0*(loopCycles - accounted)/loopCycles);
+    }
+
+    // 같은 정책을 쓰는 레벨들을 합산
+    printf("\nPer policy\n");
+    for(std::map<std::string, std::vector<unsigned long long> >::iterator it = policyCycles.begin(); it != policyCycles.end(); it++){
+        for(int phase = PHASE_LOOKUP; phase < NUM_PHASES; phase++){
+            ll n = policyCalls[it->first][phase];
+            if(n == 0) continue;
+            printf("%-12s %-8s %16llu %14lld %10.1f\n", it->first.c_str(), phaseNames[phase],
+                it->second[phase], n, (double)it->second[phase]/n);
+        }
+    }
+
+    printf("\nLoop: %llu ticks", loopCycles);
+    if(durationMs > 0){
+        printf(" (%.2f GHz)", (double)loopCycles/durationMs/1e6);
+    }
+    printf("\n");
+    for(int i = 0; i < 4; i++){
+        if(perfValues[i] >= 0){
+            printf("%-14s %lld\n", perfNames[i], perfValues[i]);
+        }
+    }
+    if(perfValues[0] > 0 && perfValues[1] >= 0){
+        printf("IPC            %.2f\n", (double)perfValues[1]/perfValues[0]);
+    }
+    printf("\n");
+}
+
+Profiler::~Profiler(){
+    for(int i = 0; i < 4; i++){
+        if(perfFds[i] != -1) close(perfFds[i]);
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "cache.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#define ll long long
+
+// 접근 루프의 단계
+enum ProfilePhase {
+    PHASE_INGEST,   // 트레이스 읽기/파싱
+    PHASE_LOOKUP,   // getBlockPosition (태그 검색)
+    PHASE_VICTIM,   // getBlockToReplace
+    PHASE_INSERT,   // insert
+    PHASE_UPDATE,   // update
+    NUM_PHASES
+};
+
+static inline unsigned long long readTsc(){
+    #if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+    #else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    #endif
+}
+
+// 단계별 TSC 누적기
+// hot path에서는 rdtsc 한 번과 카운터 두 개 갱신만 함.
+// 하드웨어 카운터(perf_event_open)는 시스템 콜 비용 때문에 루프 전체에 대해서만 읽음.
+class Profiler{
+
+    private:
+        int levels;
+        std::vector<std::string> policies;
+        std::vector<int> numbers; // 레벨 번호 (L1 = 1)
+        std::vector<unsigned long long> cycles; // [level][phase]
+        std::vector<ll> calls;                  // [level][phase]
+        unsigned long long loopStart, loopCycles;
+
+        int perfFds[4];
+        long long perfValues[4];
+
+    public:
+        Profiler(std::vector<Cache*>& cache);
+
+        // 단계가 끝났음을 기록하고 현재 TSC를 반환 (다음 단계의 시작 시각으로 사용)
+        inline unsigned long long record(int level, ProfilePhase phase, unsigned long long since){
+            unsigned long long now = readTsc();
+            cycles[level*NUM_PHASES + phase] += now - since;
+            calls[level*NUM_PHASES + phase]++;
+            return now;
+        }
+
+        void start();
+        void stop();
+        void report(ll durationMs);
+
+        ~Profiler();
+};
@@ -0,0 +1,85 @@
+#include "shadowCache.h"
+#include "hierarchy.h"
+#include <stdexcept>
+
+#define ll long long
+
+ShadowCache::ShadowCache(const LevelConfig& config, const std::vector<std::string>& policyNames, int level){
+    if(config.hasOption("banks") || config.hasOption("victim") || config.hasOption("mshr")){
+        throw std::invalid_argument("L" + std::to_string(level) + ": shadow policies cannot be combined with banks, victim or mshr");
+    }
+    try {
+        for(size_t i = 0; i < policyNames.size(); i++){
+            LevelConfig policyConfig = config;
+            policyConfig.policy = policyNames[i];
+            // 태그는 tags 배열에 모두 모아 두므로 정책 인스턴스는 태그 배열 없이 만듦
+            policies.push_back(createConfiguredCache(policyConfig, config.cacheSize, level, false));
+            if(!policies.back()->supportsShadow()){
+                throw std::invalid_argument("L" + std::to_string(level) + ": " + policyNames[i]
+                    + " keeps its own tags and cannot run as a shadow policy");
+            }
+        }
+    } catch(...){
+        for(size_t i = 0; i < policies.size(); i++) delete policies[i];
+        throw;
+    }
+    reference = policies[0];
+    count = policies.size();
+    setAssociativity = reference->getSetAssociativity();
+    numberOfSets = reference->getNumberOfSets();
+    skew = reference->getIndexFunction() == INDEX_SKEW;
+
+    tags = (ll*)malloc(numberOfSets * count * setAssociativity * sizeof(ll));
+    if(tags == NULL){
+        for(int i = 0; i < count; i++) delete policies[i];
+        throw std::runtime_error("Failed to allocate memory for shadow tags of L" + std::to_string(level) + " cache");
+    }
+    memset(tags, -1, numberOfSets * count * setAssociativity * sizeof(ll));
+}
+
+void ShadowCache::access(const Access& access){
+    ll address = access.address;
+    ll index = reference->getIndex(address);
+    ll tag = reference->getTag(address);
+
+    for(int policy = 0; policy < count; policy++){
+        Cache* cache = policies[policy];
+
+        // 태그 검색 (skewed 인덱스는 way마다 세트가 다름)
+        ll block = -1;
+        for(ll way = 0; way < setAssociativity; way++){
+            ll set = skew ? reference->getIndex(address, way) : index;
+            if(tags[(set*count + policy)*setAssociativity + way] == tag){
+                block = set*setAssociativity + way;
+                break;
+            }
+        }
+
+        if(block == -1){
+            cache->incMisses();
+            ll blockToReplace = cache->getBlockToReplace(address);
+            ll set = blockToReplace / setAssociativity;
+            tags[(set*count + policy)*setAssociativity + blockToReplace % setAssociativity] = tag;
+            cache->incMemAccs();
+            cache->update(blockToReplace, 0);
+        } else {
+            cache->incHits();
+            cache->update(block, 1);
+        }
+    }
+}
+
+int ShadowCache::getPolicies(){
+    return count;
+}
+
+Cache* ShadowCache::getCache(int policy){
+    return policies[policy];
+}
+
+ShadowCache::~ShadowCache(){
+    for(int policy = 0; policy < count; policy++){
+        delete policies[policy];
+    }
+    free(tags);
+}
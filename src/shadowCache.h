@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "cache.h"
+#include "config.h"
+
+#define ll long long
+
+// 같은 구성의 레벨을 여러 교체 정책으로 한 번에 시뮬레이션 (--shadow <policy,...>)
+// 태그는 [세트][정책][way] 순서로 한 배열에 모아 두므로, 한 접근의 세트를 모든 정책이 볼 때
+// 이어진 메모리만 읽음. 인덱스와 태그도 접근마다 한 번만 계산함.
+// 교체 결정(getBlockToReplace/update)과 히트/미스 카운터는 각 정책 객체에 그대로 맡김.
+// 정책 객체의 태그 배열은 쓰지 않으므로 Cache::supportsShadow() 가 false 인 정책(upgradedLRU)은 쓸 수 없음.
+class ShadowCache{
+
+    private:
+        std::vector<Cache*> policies;
+        Cache* reference; // 인덱스/태그 계산용 (모든 정책의 구성이 같음)
+        int count;
+        ll setAssociativity;
+        ll numberOfSets;
+        bool skew;
+        ll* tags; // [set][policy][way], 빈 블록은 -1
+
+    public:
+        // config 의 구성과 인덱스 함수로 정책마다 캐시를 만듦 (level 은 레벨 번호)
+        // 쓸 수 없는 정책이나 옵션이면 std::invalid_argument
+        ShadowCache(const LevelConfig& config, const std::vector<std::string>& policyNames, int level);
+
+        void access(const Access& access);
+
+        int getPolicies();
+        Cache* getCache(int policy);
+
+        ~ShadowCache();
+};
@@ -0,0 +1,295 @@
+#include "simpoint.h"
+#include <algorithm>
+#include <chrono>
+#include <float.h>
+#include <stdexcept>
+#include "hierarchy.h"
+#include "traceReader.h"
+
+#define ll long long
+
+// splitmix64: 영역 번호를 시그니처 차원에 흩고, k-means 초기값을 고르는 데 씀
+static inline unsigned long long mix(unsigned long long z){
+    z += 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static double distance2(const std::vector<double>& a, const std::vector<double>& b){
+    double sum = 0;
+    for(size_t i = 0; i < a.size(); i++){
+        double d = a[i] - b[i];
+        sum += d * d;
+    }
+    return sum;
+}
+
+// k-means++ 로 초기값을 고른 뒤 할당이 바뀌지 않을 때까지 Lloyd 반복
+// 반환값은 점마다의 클러스터, sse 는 제곱 오차의 합
+static std::vector<int> kmeans(const std::vector<std::vector<double> >& points, int k,
+    unsigned long long seed, std::vector<std::vector<double> >& centers, double& sse){
+    size_t n = points.size();
+    unsigned long long state = seed;
+    centers.clear();
+    centers.push_back(points[mix(state++) % n]);
+    std::vector<double> nearest(n, DBL_MAX);
+    while((int)centers.size() < k){
+        double total = 0;
+        for(size_t i = 0; i < n; i++){
+            nearest[i] = std::min(nearest[i], distance2(points[i], centers.back()));
+            total += nearest[i];
+        }
+        if(total == 0) break; // 서로 다른 점이 k 개보다 적음
+        // 가장 가까운 중심까지 거리의 제곱에 비례하는 확률로 다음 중심을 고름
+        double target = (mix(state++) >> 11) * (1.0 / (1ULL << 53)) * total;
+        size_t chosen = 0;
+        for(; chosen + 1 < n; chosen++){
+            target -= nearest[chosen];
+            if(target < 0) break;
+        }
+        centers.push_back(points[chosen]);
+    }
+
+    std::vector<int> assignment(n, -1);
+    for(int iteration = 0; iteration < SIMPOINT_ITERATIONS; iteration++){
+        bool changed = false;
+        sse = 0;
+        for(size_t i = 0; i < n; i++){
+            int best = 0;
+            double bestDistance = DBL_MAX;
+            for(size_t c = 0; c < centers.size(); c++){
+                double d = distance2(points[i], centers[c]);
+                if(d < bestDistance){
+                    bestDistance = d;
+                    best = c;
+                }
+            }
+            if(assignment[i] != best){
+                assignment[i] = best;
+                changed = true;
+            }
+            sse += bestDistance;
+        }
+        if(!changed) break;
+
+        // 빈 클러스터의 중심은 그대로 둠
+        std::vector<std::vector<double> > sums(centers.size(), std::vector<double>(points[0].size(), 0));
+        std::vector<ll> members(centers.size(), 0);
+        for(size_t i = 0; i < n; i++){
+            for(size_t d = 0; d < points[i].size(); d++) sums[assignment[i]][d] += points[i][d];
+            members[assignment[i]]++;
+        }
+        for(size_t c = 0; c < centers.size(); c++){
+            if(members[c] == 0) continue;
+            for(size_t d = 0; d < sums[c].size(); d++) centers[c][d] = sums[c][d] / members[c];
+        }
+    }
+    return assignment;
+}
+
+IntervalProfiler::IntervalProfiler(ll interval){
+    if(interval <= 0){
+        throw std::invalid_argument("Invalid SimPoint interval: " + std::to_string(interval));
+    }
+    this->interval = interval;
+    this->left = interval;
+    this->accesses = 0;
+    current.assign(SIMPOINT_DIMENSIONS, 0);
+}
+
+void IntervalProfiler::closeInterval(){
+    ll length = interval - left;
+    for(int d = 0; d < SIMPOINT_DIMENSIONS; d++) current[d] /= length;
+    signatures.push_back(current);
+    lengths.push_back(length);
+    current.assign(SIMPOINT_DIMENSIONS, 0);
+    left = interval;
+}
+
+void IntervalProfiler::record(const Access& access){
+    unsigned long long region = (unsigned long long)access.address >> SIMPOINT_REGION_BITS;
+    current[mix(region) % SIMPOINT_DIMENSIONS] += 1;
+    accesses++;
+    if(--left == 0) closeInterval();
+}
+
+void IntervalProfiler::finish(){
+    if(left != interval) closeInterval();
+}
+
+std::vector<SimPoint> IntervalProfiler::select(int clusters){
+    std::vector<SimPoint> points;
+    if(signatures.empty()) return points;
+    int k = std::min((ll)clusters, getIntervals());
+
+    std::vector<int> best;
+    std::vector<std::vector<double> > bestCenters;
+    double bestSse = DBL_MAX;
+    for(int restart = 0; restart < SIMPOINT_RESTARTS; restart++){
+        std::vector<std::vector<double> > centers;
+        double sse;
+        std::vector<int> assignment = kmeans(signatures, k, restart + 1, centers, sse);
+        if(sse < bestSse){
+            bestSse = sse;
+            best = assignment;
+            bestCenters = centers;
+        }
+    }
+
+    // 클러스터마다 중심에 가장 가까운 구간이 대표
+    std::vector<ll> representative(bestCenters.size(), -1), weight(bestCenters.size(), 0);
+    std::vector<double> closest(bestCenters.size(), DBL_MAX);
+    for(size_t i = 0; i < signatures.size(); i++){
+        int c = best[i];
+        weight[c] += lengths[i];
+        double d = distance2(signatures[i], bestCenters[c]);
+        if(d < closest[c]){
+            closest[c] = d;
+            representative[c] = i;
+        }
+    }
+    for(size_t c = 0; c < bestCenters.size(); c++){
+        if(representative[c] < 0) continue;
+        ll i = representative[c];
+        points.push_back({i, i * interval, lengths[i], (int)c, weight[c]});
+    }
+    std::sort(points.begin(), points.end(), [](const SimPoint& a, const SimPoint& b){ return a.start < b.start; });
+    return points;
+}
+
+ll IntervalProfiler::getIntervals(){
+    return signatures.size();
+}
+
+ll IntervalProfiler::getAccesses(){
+    return accesses;
+}
+
+// 시뮬레이션 중인 대표 구간 하나 (warm-up 부터 구간 끝까지 자기 계층을 가짐)
+struct SimPointRun {
+    SimPoint point;
+    Hierarchy* hierarchy;
+    std::vector<ll> hits, misses, memAccs; // 구간이 시작할 때의 값, 끝나면 구간 동안의 차이
+};
+
+static void snapshot(SimPointRun& run, bool difference){
+    for(int level = 0; level < run.hierarchy->getLevels(); level++){
+        Cache* cache = run.hierarchy->getCache(level);
+        run.hits[level] = cache->getHits() - (difference ? run.hits[level] : 0);
+        run.misses[level] = cache->getMisses() - (difference ? run.misses[level] : 0);
+        run.memAccs[level] = cache->getMemAccs() - (difference ? run.memAccs[level] : 0);
+    }
+}
+
+void runSimPoint(const std::vector<LevelConfig>& config, const std::string& tracePath, ll interval, int clusters, ll warmup){
+    if(clusters <= 0 || warmup < 0){
+        throw std::invalid_argument("Invalid SimPoint parameters: " + std::to_string(clusters) + " clusters, warm-up "
+            + std::to_string(warmup));
+    }
+    // 보고에 쓸 레벨 번호와 정책 이름 (설정이 잘못되었으면 트레이스를 읽기 전에 실패함)
+    std::vector<int> numbers;
+    std::vector<std::string> policies;
+    {
+        Hierarchy hierarchy(config);
+        for(int level = 0; level < hierarchy.getLevels(); level++){
+            numbers.push_back(hierarchy.getCache(level)->getLevel());
+            policies.push_back(hierarchy.getCache(level)->getPolicy());
+        }
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // 구간별 시그니처 (시뮬레이션 없이 읽기만 함)
+    IntervalProfiler profiler(interval);
+    {
+        TraceReader trace(tracePath);
+        while(true){
+            Access access = trace.next();
+            if(access.accessType == -1) break;
+            profiler.record(access);
+        }
+    }
+    profiler.finish();
+    std::vector<SimPoint> points = profiler.select(clusters);
+    auto selected = std::chrono::high_resolution_clock::now();
+
+    // 대표 구간만 시뮬레이션. warm-up이 앞 구간과 겹칠 수 있으므로 구간마다 계층을 따로 둠
+    int levels = config.size();
+    std::vector<SimPointRun> runs;
+    std::vector<SimPointRun*> active;
+    ll position = 0, simulated = 0, warmed = 0;
+    size_t next = 0;
+    ll end = points.empty() ? 0 : points.back().start + points.back().length;
+    runs.reserve(points.size());
+    TraceReader trace(tracePath);
+    while(position < end){
+        while(next < points.size() && std::max(0LL, points[next].start - warmup) <= position){
+            runs.push_back({points[next], new Hierarchy(config), std::vector<ll>(levels, 0),
+                std::vector<ll>(levels, 0), std::vector<ll>(levels, 0)});
+            active.push_back(&runs.back());
+            next++;
+        }
+        Access access = trace.next();
+        if(access.accessType == -1) break;
+        for(size_t i = 0; i < active.size(); i++){
+            SimPointRun& run = *active[i];
+            if(position == run.point.start) snapshot(run, false);
+            if(position < run.point.start) warmed++;
+            run.hierarchy->access(access);
+            simulated++;
+        }
+        position++;
+        // 끝난 구간의 결과를 남기고 계층을 정리 (건너뛰는 구간에서는 읽기만 함)
+        for(size_t i = 0; i < active.size(); ){
+            SimPointRun& run = *active[i];
+            if(position == run.point.start + run.point.length){
+                snapshot(run, true);
+                delete run.hierarchy;
+                run.hierarchy = NULL;
+                active.erase(active.begin() + i);
+            }
+            else{
+                i++;
+            }
+        }
+    }
+    auto stop = std::chrono::high_resolution_clock::now();
+
+    ll total = profiler.getAccesses();
+    printf("\nSimPoint: %lld accesses in %lld intervals of %lld, %zu representatives (warm-up %lld)\n\n",
+        total, profiler.getIntervals(), interval, points.size(), warmup);
+    printf("%-10s %14s %14s %8s\n", "Interval", "Start", "Represents", "Weight");
+    for(size_t i = 0; i < runs.size(); i++){
+        const SimPoint& point = runs[i].point;
+        printf("%-10lld %14lld %14lld %7.2f%%\n", point.interval, point.start, point.weight,
+            total > 0 ? 100.0 * point.weight / total : 0.0);
+    }
+    printf("\n");
+
+    // 레벨별 추정치: 대표 구간의 결과를 클러스터가 대표하는 접근 수만큼 늘려 합침
+    for(int level = 0; level < levels; level++){
+        double hits = 0, misses = 0, memAccs = 0;
+        for(size_t i = 0; i < runs.size(); i++){
+            if(runs[i].hierarchy != NULL) continue; // 트레이스가 예상보다 일찍 끝남
+            double scale = (double)runs[i].point.weight / runs[i].point.length;
+            hits += scale * runs[i].hits[level];
+            misses += scale * runs[i].misses[level];
+            memAccs += scale * runs[i].memAccs[level];
+        }
+        printf("L%d: %s (weighted)\t\t\t\tHit Rate: %f\n", numbers[level], policies[level].c_str(),
+            hits + misses == 0 ? 0.0 : hits / (hits + misses));
+        printf("Accesses: %.0f\t\tHits: %.0f\t\tMisses: %.0f\n", hits + misses, hits, misses);
+        printf("Memory Access: %.0f times\n", memAccs);
+        printf("\n");
+    }
+
+    printf("Simulated %lld of %lld accesses (%.2f%%, %lld in warm-up)\n", simulated, total,
+        total > 0 ? 100.0 * simulated / total : 0.0, warmed);
+    printf("Duration: %lld ms selection, %lld ms simulation\n\n",
+        (ll)std::chrono::duration_cast<std::chrono::milliseconds>(selected - start).count(),
+        (ll)std::chrono::duration_cast<std::chrono::milliseconds>(stop - selected).count());
+
+    for(size_t i = 0; i < runs.size(); i++){
+        delete runs[i].hierarchy;
+    }
+}
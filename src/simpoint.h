@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "cache.h"
+#include "config.h"
+
+#define ll long long
+
+// 대표 구간 시뮬레이션 (--simpoint, SimPoint 방식)
+// 1단계: 트레이스를 고정 길이 구간으로 나누고 구간마다 주소 영역 시그니처를 만듦
+// 2단계: 시그니처를 k-means로 묶고 클러스터마다 중심에 가장 가까운 구간을 대표로 고름
+// 3단계: 대표 구간만 (앞의 warm-up 접근으로 캐시를 데운 뒤) 시뮬레이션하고,
+//        나머지는 읽기만 하고 건너뜀. 결과는 클러스터가 대표하는 접근 수로 가중해 합침.
+
+#ifndef SIMPOINT_INTERVAL
+#define SIMPOINT_INTERVAL 1000000
+#endif
+
+#ifndef SIMPOINT_CLUSTERS
+#define SIMPOINT_CLUSTERS 10
+#endif
+
+#ifndef SIMPOINT_WARMUP
+#define SIMPOINT_WARMUP 1000000
+#endif
+
+// 시그니처 차원 수 (영역 번호를 해시해서 나눔)와 영역 크기 (4 KB 페이지)
+#define SIMPOINT_DIMENSIONS 32
+#define SIMPOINT_REGION_BITS 12
+
+// k-means를 다른 초기값으로 다시 돌리는 횟수 (제곱 오차가 가장 작은 결과를 씀)
+#define SIMPOINT_RESTARTS 5
+#define SIMPOINT_ITERATIONS 100
+
+struct SimPoint {
+    ll interval;      // 구간 번호
+    ll start, length; // 첫 접근의 위치와 접근 수
+    int cluster;
+    ll weight;        // 이 구간이 대표하는 접근 수 (클러스터에 속한 구간들의 길이 합)
+};
+
+class IntervalProfiler{
+
+    private:
+        ll interval;
+        ll left;
+        ll accesses;
+        std::vector<double> current;
+        std::vector<std::vector<double> > signatures; // 구간별, 합이 1이 되도록 정규화
+        std::vector<ll> lengths;
+
+        void closeInterval();
+
+    public:
+        // interval: 구간 길이 (접근)
+        IntervalProfiler(ll interval);
+
+        void record(const Access& access);
+        // 마지막으로 채워지지 않은 구간도 기록
+        void finish();
+
+        // 최대 clusters 개의 대표 구간 (위치 순)
+        std::vector<SimPoint> select(int clusters);
+
+        ll getIntervals();
+        ll getAccesses();
+};
+
+// tracePath (-t 또는 gen:<spec>) 를 두 번 읽어 대표 구간을 고르고 시뮬레이션한 뒤 추정치를 출력
+void runSimPoint(const std::vector<LevelConfig>& config, const std::string& tracePath, ll interval, int clusters, ll warmup);
@@ -0,0 +1,186 @@
+#include "stats.h"
+#include <stdexcept>
+
+#define ll long long
+
+CacheStats::CacheStats(Cache* cache, ll interval){
+    this->level = cache->getLevel();
+    this->policy = cache->getPolicy();
+    this->numberOfSets = cache->getNumberOfSets();
+    this->setAssociativity = cache->getSetAssociativity();
+    this->interval = interval > 0 ? interval : STATS_INTERVAL;
+    this->intervalLeft = this->interval;
+    this->time = 0;
+    this->intervalHits = 0;
+    this->intervalMisses = 0;
+    memset(reuseHistogram, 0, sizeof(reuseHistogram));
+
+    setAccesses = (ll*)calloc(numberOfSets, sizeof(ll));
+    setMisses = (ll*)calloc(numberOfSets, sizeof(ll));
+    lastTouch = (ll*)calloc(numberOfSets * setAssociativity, sizeof(ll));
+    if(setAccesses == NULL || setMisses == NULL || lastTouch == NULL){
+        free(setAccesses);
+        free(setMisses);
+        free(lastTouch);
+        throw std::runtime_error("Failed to allocate memory for statistics of L" + std::to_string(level) + " cache");
+    }
+}
+
+void CacheStats::tick(){
+    if(--intervalLeft == 0){
+        hitSeries.push_back(intervalHits);
+        missSeries.push_back(intervalMisses);
+        intervalHits = 0;
+        intervalMisses = 0;
+        intervalLeft = interval;
+    }
+}
+
+void CacheStats::recordHit(ll block){
+    time++;
+    setAccesses[block/setAssociativity]++;
+
+    // 같은 프레임에 대한 직전 접근 이후 이 레벨에 들어온 접근 수
+    int bucket = log2(time - lastTouch[block]);
+    if(bucket >= REUSE_BUCKETS) bucket = REUSE_BUCKETS-1;
+    reuseHistogram[bucket]++;
+    lastTouch[block] = time;
+
+    intervalHits++;
+    tick();
+}
+
+void CacheStats::recordMiss(ll block){
+    time++;
+    setAccesses[block/setAssociativity]++;
+    setMisses[block/setAssociativity]++;
+    lastTouch[block] = time;
+
+    intervalMisses++;
+    tick();
+}
+
+// 마지막으로 채워지지 않은 구간도 기록
+void CacheStats::finish(){
+    if(intervalLeft != interval){
+        hitSeries.push_back(intervalHits);
+        missSeries.push_back(intervalMisses);
+        intervalHits = 0;
+        intervalMisses = 0;
+        intervalLeft = interval;
+    }
+}
+
+void CacheStats::writeSetsCsv(FILE* out){
+    for(ll set = 0; set < numberOfSets; set++){
+        fprintf(out, "%d,%lld,%lld,%lld\n", level, set, setAccesses[set], setMisses[set]);
+    }
+}
+
+void CacheStats::writeReuseCsv(FILE* out){
+    for(int bucket = 0; bucket < REUSE_BUCKETS; bucket++){
+        fprintf(out, "%d,%lld,%lld\n", level, 1LL<<bucket, reuseHistogram[bucket]);
+    }
+}
+
+void CacheStats::writeIntervalsCsv(FILE* out){
+    for(size_t i = 0; i < hitSeries.size(); i++){
+        ll accesses = hitSeries[i] + missSeries[i];
+        fprintf(out, "%d,%zu,%lld,%lld,%lld,%f\n", level, i, accesses, hitSeries[i], missSeries[i],
+            accesses == 0 ? 0.0 : (double)hitSeries[i]/accesses);
+    }
+}
+
+void CacheStats::writeJson(FILE* out){
+    fprintf(out, "    {\n");
+    fprintf(out, "      \"level\": %d,\n", level);
+    fprintf(out, "      \"policy\": \"%s\",\n", policy.c_str());
+    fprintf(out, "      \"sets\": %lld,\n", numberOfSets);
+    fprintf(out, "      \"associativity\": %lld,\n", setAssociativity);
+    fprintf(out, "      \"interval\": %lld,\n", interval);
+
+    fprintf(out, "      \"setAccesses\": [");
+    for(ll set = 0; set < numberOfSets; set++){
+        fprintf(out, set ? ",%lld" : "%lld", setAccesses[set]);
+    }
+    fprintf(out, "],\n");
+
+    fprintf(out, "      \"setMisses\": [");
+    for(ll set = 0; set < numberOfSets; set++){
+        fprintf(out, set ? ",%lld" : "%lld", setMisses[set]);
+    }
+    fprintf(out, "],\n");
+
+    // i 번째 원소는 [2^i, 2^(i+1)) 간격의 재사용 횟수
+    fprintf(out, "      \"reuseLog2Histogram\": [");
+    for(int bucket = 0; bucket < REUSE_BUCKETS; bucket++){
+        fprintf(out, bucket ? ",%lld" : "%lld", reuseHistogram[bucket]);
+    }
+    fprintf(out, "],\n");
+
+    fprintf(out, "      \"intervalHits\": [");
+    for(size_t i = 0; i < hitSeries.size(); i++){
+        fprintf(out, i ? ",%lld" : "%lld", hitSeries[i]);
+    }
+    fprintf(out, "],\n");
+
+    fprintf(out, "      \"intervalMisses\": [");
+    for(size_t i = 0; i < missSeries.size(); i++){
+        fprintf(out, i ? ",%lld" : "%lld", missSeries[i]);
+    }
+    fprintf(out, "]\n");
+    fprintf(out, "    }");
+}
+
+CacheStats::~CacheStats(){
+    free(setAccesses);
+    free(setMisses);
+    free(lastTouch);
+}
+
+static FILE* openStatsFile(const char* prefix, const char* suffix){
+    std::string path = std::string(prefix) + suffix;
+    FILE* out = fopen(path.c_str(), "w");
+    if(out == NULL){
+        printf("Failed to open %s for writing\n", path.c_str());
+    }
+    return out;
+}
+
+void dumpStats(std::vector<CacheStats*>& stats, const char* prefix){
+    for(size_t i = 0; i < stats.size(); i++){
+        stats[i]->finish();
+    }
+
+    FILE* out = openStatsFile(prefix, ".json");
+    if(out != NULL){
+        fprintf(out, "{\n  \"levels\": [\n");
+        for(size_t i = 0; i < stats.size(); i++){
+            stats[i]->writeJson(out);
+            fprintf(out, i+1 < stats.size() ? ",\n" : "\n");
+        }
+        fprintf(out, "  ]\n}\n");
+        fclose(out);
+    }
+
+    out = openStatsFile(prefix, "_sets.csv");
+    if(out != NULL){
+        fprintf(out, "level,set,accesses,misses\n");
+        for(size_t i = 0; i < stats.size(); i++) stats[i]->writeSetsCsv(out);
+        fclose(out);
+    }
+
+    out = openStatsFile(prefix, "_reuse.csv");
+    if(out != NULL){
+        fprintf(out, "level,reuseAtLeast,count\n");
+        for(size_t i = 0; i < stats.size(); i++) stats[i]->writeReuseCsv(out);
+        fclose(out);
+    }
+
+    out = openStatsFile(prefix, "_intervals.csv");
+    if(out != NULL){
+        fprintf(out, "level,interval,accesses,hits,misses,hitRate\n");
+        for(size_t i = 0; i < stats.size(); i++) stats[i]->writeIntervalsCsv(out);
+        fclose(out);
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include "cache.h"
+
+#define ll long long
+
+// 재사용 간격 히스토그램 버킷 수 (log2 단위, 마지막 버킷은 그 이상 전부)
+#define REUSE_BUCKETS 40
+
+#ifndef STATS_INTERVAL
+#define STATS_INTERVAL 100000
+#endif
+
+#ifndef STATS_PREFIX
+#define STATS_PREFIX "stats"
+#endif
+
+// 레벨 하나에 대한 온라인 통계
+// 세트별 접근/미스 수, 재사용 간격 히스토그램, N 접근 단위 구간별 히트율을 기록함.
+// hot path에서는 고정 크기 카운터만 갱신하고, 구간 기록은 구간이 끝날 때 한 번만 추가함.
+class CacheStats{
+
+    private:
+        int level;
+        std::string policy;
+        ll numberOfSets;
+        ll setAssociativity;
+
+        ll* setAccesses;
+        ll* setMisses;
+        ll* lastTouch; // 블록 프레임별 마지막 접근 시각 (0 = 아직 채워지지 않음)
+        ll reuseHistogram[REUSE_BUCKETS];
+
+        ll time; // 이 레벨에 들어온 접근 수
+        ll interval;
+        ll intervalLeft;
+        ll intervalHits, intervalMisses;
+        std::vector<ll> hitSeries;
+        std::vector<ll> missSeries;
+
+        void tick();
+
+    public:
+        CacheStats(Cache* cache, ll interval);
+
+        void recordHit(ll block);
+        void recordMiss(ll block);
+        void finish();
+
+        void writeSetsCsv(FILE* out);
+        void writeReuseCsv(FILE* out);
+        void writeIntervalsCsv(FILE* out);
+        void writeJson(FILE* out);
+
+        ~CacheStats();
+};
+
+// <prefix>.json 과 <prefix>_sets.csv, <prefix>_reuse.csv, <prefix>_intervals.csv 를 생성
+void dumpStats(std::vector<CacheStats*>& stats, const char* prefix);
@@ -0,0 +1,363 @@
+#include "sweep.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include "hierarchy.h"
+#include "policyRegistry.h"
+#include "threadPool.h"
+#include "traceReader.h"
+
+#define ll long long
+
+// "a,b,c" 와 "a..b"(두 배씩)를 값 목록으로 펼침 (size면 64K 같은 접미사를 숫자로 바꿈)
+static std::vector<std::string> expandValues(const std::string& key, const std::string& list, bool size){
+    std::vector<std::string> values;
+    std::istringstream items(list);
+    std::string item;
+    while(std::getline(items, item, ',')){
+        size_t range = item.find("..");
+        if(range == std::string::npos){
+            values.push_back(size ? std::to_string(parseSize(key, item)) : item);
+            continue;
+        }
+        ll from = parseSize(key, item.substr(0, range));
+        ll to = parseSize(key, item.substr(range + 2));
+        if(from <= 0 || to < from){
+            throw std::invalid_argument("Invalid range for " + key + ": " + item);
+        }
+        for(ll value = from; value <= to; value *= 2){
+            values.push_back(std::to_string(value));
+        }
+    }
+    if(values.empty()){
+        throw std::invalid_argument("No values for " + key);
+    }
+    return values;
+}
+
+// 레벨 줄 하나의 모든 조합
+static std::vector<LevelConfig> expandLevel(const std::string& line, int level){
+    static const char* fieldNames[4] = {"policy", "cacheSize", "blockSize", "setAssociativity"};
+
+    std::istringstream fields(line);
+    std::vector<std::string> prefixes; // 조합마다의 params.cfg 줄
+    std::string field;
+    int position = 0;
+    prefixes.push_back("");
+    while(fields >> field){
+        std::string key = position < 4 ? fieldNames[position] : field.substr(0, field.find('='));
+        std::string list = position < 4 ? field : field.substr(std::min(field.size(), key.size() + 1));
+        std::string prefix = position < 4 ? "" : key + "=";
+        std::vector<std::string> values = expandValues(key, list, position >= 1 && position < 4);
+
+        std::vector<std::string> expanded;
+        for(size_t i = 0; i < prefixes.size(); i++){
+            for(size_t j = 0; j < values.size(); j++){
+                expanded.push_back(prefixes[i] + (position ? " " : "") + prefix + values[j]);
+            }
+        }
+        prefixes.swap(expanded);
+        position++;
+    }
+    if(position < 4){
+        throw std::invalid_argument("Invalid sweep level L" + std::to_string(level) + ": " + line);
+    }
+
+    std::vector<LevelConfig> candidates;
+    for(size_t i = 0; i < prefixes.size(); i++){
+        candidates.push_back(parseLevel(prefixes[i], level));
+    }
+    return candidates;
+}
+
+static bool isValidGeometry(const LevelConfig& level){
+    ll frame = level.blockSize * level.setAssociativity;
+    return level.blockSize > 0 && level.setAssociativity > 0 && level.cacheSize >= frame && level.cacheSize % frame == 0;
+}
+
+// 돌려 봐야 실패할 작업을 건너뛰도록 정책과 인덱스 함수 이름을 미리 확인 (잘못된 이름은 한 번만 알림)
+static bool isKnownLevel(const LevelConfig& level, std::set<std::string>& reported){
+    if(level.hasOption("plugin")){
+        std::string error;
+        std::string path = level.getOption("plugin", "");
+        if(!loadPolicyPlugin(path, error)){
+            if(reported.insert("plugin " + path).second){
+                printf("Failed to load policy plugin %s: %s (its jobs are skipped)\n", path.c_str(), error.c_str());
+            }
+            return false;
+        }
+    }
+    std::vector<std::string> names = getPolicyNames();
+    if(std::find(names.begin(), names.end(), level.policy) == names.end()){
+        if(reported.insert("policy " + level.policy).second){
+            printf("Unknown policy in sweep: %s (its jobs are skipped)\n", level.policy.c_str());
+        }
+        return false;
+    }
+    IndexFunction function;
+    std::string indexName = level.getOption("index", "bits");
+    if(!parseIndexFunction(indexName, function)){
+        if(reported.insert("index " + indexName).second){
+            printf("Unknown index function in sweep: %s (its jobs are skipped)\n", indexName.c_str());
+        }
+        return false;
+    }
+    return true;
+}
+
+// 트레이스의 접근 수 추정 (스케줄링용, 모든 트레이스를 같은 단위로)
+// 앞부분을 읽고 읽은 비율로 나눔. 생성기와 compact 트레이스는 비율이 정확하고,
+// 텍스트 트레이스는 압축된 파일에서의 위치로 압축률을 어림함.
+#define COST_SAMPLE (1 << 20)
+
+static ll estimateCost(const std::string& trace){
+    try {
+        TraceReader reader(trace);
+        ll sampled = 0;
+        while(sampled < COST_SAMPLE && reader.next().accessType != -1) sampled++;
+        double progress = reader.getProgress();
+        return progress > 0 && progress < 1 ? (ll)(sampled / progress) : sampled;
+    } catch(const std::invalid_argument&){
+        return 0; // 열 수 없거나 잘못된 트레이스는 작업을 돌릴 때 실패로 보고함
+    }
+}
+
+std::vector<SweepJob> expandSweep(const char* specPath, ll& skipped){
+    std::ifstream spec(specPath);
+    if(!spec.is_open()){
+        throw std::invalid_argument("Failed to open sweep specification " + std::string(specPath));
+    }
+
+    std::vector<std::string> traces;
+    std::vector<std::vector<LevelConfig> > levels; // 레벨별 후보
+    std::string line;
+    while(std::getline(spec, line)){
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string keyword;
+        if(!(fields >> keyword)) continue; // 빈 줄
+
+        std::string rest;
+        std::getline(fields, rest);
+        rest = rest.substr(std::min(rest.size(), rest.find_first_not_of(" \t")));
+        rest = rest.substr(0, rest.find_last_not_of(" \t\r") + 1);
+        if(keyword == "trace" && !rest.empty()){
+            if(!isReadableTrace(rest)){
+                throw std::invalid_argument("Failed to open trace " + rest);
+            }
+            traces.push_back(rest);
+        } else if(keyword == "level"){
+            levels.push_back(expandLevel(rest, levels.size() + 1));
+        } else {
+            throw std::invalid_argument("Invalid line in " + std::string(specPath) + ": " + line);
+        }
+    }
+    if(traces.empty() || levels.empty()){
+        throw std::invalid_argument(std::string(specPath) + " needs at least one trace and one level");
+    }
+
+    // 레벨별 후보의 곱을 혼합 기수 카운터로 순회
+    std::vector<SweepJob> jobs;
+    std::set<std::string> reported;
+    skipped = 0;
+    for(size_t t = 0; t < traces.size(); t++){
+        ll traceCost = estimateCost(traces[t]);
+        std::vector<size_t> choice(levels.size(), 0);
+        while(true){
+            SweepJob job;
+            job.trace = traces[t];
+            bool valid = true;
+            for(size_t level = 0; level < levels.size(); level++){
+                const LevelConfig& config = levels[level][choice[level]];
+                valid = valid && isValidGeometry(config) && isKnownLevel(config, reported);
+                job.config.push_back(config);
+                job.description += (level ? "; " : "") + describeLevel(config);
+            }
+            job.cost = traceCost * levels.size();
+            if(valid) jobs.push_back(job);
+            else skipped++;
+
+            size_t level = 0;
+            while(level < levels.size() && ++choice[level] == levels[level].size()){
+                choice[level++] = 0;
+            }
+            if(level == levels.size()) break;
+        }
+    }
+    return jobs;
+}
+
+static std::string quoteCsv(const std::string& field){
+    std::string quoted = "\"";
+    for(size_t i = 0; i < field.size(); i++){
+        if(field[i] == '"') quoted += '"';
+        quoted += field[i];
+    }
+    return quoted + "\"";
+}
+
+// CSV 줄의 앞쪽 필드 count개
+static std::vector<std::string> readCsvFields(const std::string& line, size_t count){
+    std::vector<std::string> fields;
+    std::string field;
+    bool quoted = false;
+    for(size_t i = 0; i < line.size() && fields.size() < count; i++){
+        char c = line[i];
+        if(quoted){
+            if(c == '"' && i + 1 < line.size() && line[i+1] == '"') field += line[++i];
+            else if(c == '"') quoted = false;
+            else field += c;
+        } else if(c == '"'){
+            quoted = true;
+        } else if(c == ','){
+            fields.push_back(field);
+            field.clear();
+        } else if(c != '\r'){
+            field += c;
+        }
+    }
+    if(fields.size() < count) fields.push_back(field);
+    return fields;
+}
+
+// 결과 파일과 진행 상황 (여러 작업 스레드가 공유)
+class SweepResults{
+
+    private:
+        FILE* out;
+        std::mutex lock;
+        std::set<std::pair<std::string, std::string> > completed; // (trace, config)
+        ll total, done, failed;
+
+    public:
+        SweepResults(const char* path){
+            std::ifstream existing(path);
+            std::string line;
+            while(std::getline(existing, line)){
+                std::vector<std::string> fields = readCsvFields(line, 2);
+                if(fields.size() == 2) completed.insert(std::make_pair(fields[0], fields[1]));
+            }
+
+            struct stat info;
+            bool empty = stat(path, &info) != 0 || info.st_size == 0;
+            out = fopen(path, "a");
+            if(out == NULL){
+                throw std::runtime_error("Failed to open " + std::string(path) + " for writing");
+            }
+            if(empty){
+                fprintf(out, "trace,config,level,policy,accesses,hits,misses,hitRate,memoryAccesses,durationMs\n");
+                fflush(out);
+            }
+            total = done = failed = 0;
+        }
+
+        bool isCompleted(const SweepJob& job){
+            return completed.count(std::make_pair(job.trace, job.description)) != 0;
+        }
+
+        void setTotal(ll total){
+            this->total = total;
+        }
+
+        // 작업 하나의 모든 레벨을 한 번에 써서 중간에 끊겨도 작업 단위로 남도록 함
+        void record(const SweepJob& job, Hierarchy& hierarchy, ll durationMs){
+            std::string rows;
+            std::ostringstream summary;
+            for(int level = 0; level < hierarchy.getLevels(); level++){
+                Cache* cache = hierarchy.getCache(level);
+                std::string policy = cache->getPolicy();
+                policy = policy.substr(0, policy.find_last_not_of(' ') + 1); // 출력 정렬용 공백 제거
+                char row[256];
+                snprintf(row, sizeof(row), ",%d,%s,%lld,%lld,%lld,%f,%lld,%lld\n", level + 1, policy.c_str(),
+                    cache->getHits() + cache->getMisses(), cache->getHits(), cache->getMisses(), cache->getHitRate(),
+                    cache->getMemAccs(), durationMs);
+                rows += quoteCsv(job.trace) + "," + quoteCsv(job.description) + row;
+                summary << (level ? ", " : "") << "L" << level + 1 << " " << cache->getHitRate();
+            }
+
+            std::lock_guard<std::mutex> guard(lock);
+            fputs(rows.c_str(), out);
+            fflush(out);
+            done++;
+            printf("[%lld/%lld] %s | %s: %s (%lld ms)\n", done + failed, total, job.trace.c_str(),
+                job.description.c_str(), summary.str().c_str(), durationMs);
+            fflush(stdout);
+        }
+
+        void fail(const SweepJob& job, const char* reason){
+            std::lock_guard<std::mutex> guard(lock);
+            failed++;
+            printf("[%lld/%lld] %s | %s: failed (%s)\n", done + failed, total, job.trace.c_str(),
+                job.description.c_str(), reason);
+            fflush(stdout);
+        }
+
+        ll getFailed(){
+            return failed;
+        }
+
+        ~SweepResults(){
+            fclose(out);
+        }
+};
+
+// 설정이나 트레이스가 잘못된 작업은 실패로 기록하고 나머지 작업은 계속함
+static void runJob(const SweepJob& job, SweepResults& results){
+    try {
+        Hierarchy hierarchy(job.config);
+        TraceReader trace(job.trace);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        while(true){
+            Access access = trace.next();
+            if(access.accessType == -1) break;
+            hierarchy.accessAs<false, false, false>(access);
+        }
+        auto stop = std::chrono::high_resolution_clock::now();
+        results.record(job, hierarchy, std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count());
+    } catch(const std::exception& error){
+        results.fail(job, error.what());
+    }
+}
+
+static bool costlier(const SweepJob& a, const SweepJob& b){
+    return a.cost > b.cost;
+}
+
+void runSweep(const char* specPath, const char* resultsPath, int threads){
+    ll skipped;
+    std::vector<SweepJob> jobs = expandSweep(specPath, skipped);
+    SweepResults results(resultsPath);
+
+    std::vector<SweepJob> pending;
+    for(size_t i = 0; i < jobs.size(); i++){
+        if(!results.isCompleted(jobs[i])) pending.push_back(jobs[i]);
+    }
+    // 긴 작업부터 시작해야 마지막에 긴 작업 하나만 남는 일이 줄어듦
+    std::stable_sort(pending.begin(), pending.end(), costlier);
+    results.setTotal(pending.size());
+
+    WorkStealingPool pool(threads);
+    printf("Sweep: %zu jobs (%zu already in %s, %lld invalid configurations skipped), %zu to run on %d threads\n\n",
+        jobs.size(), jobs.size() - pending.size(), resultsPath, skipped, pending.size(), pool.getThreads());
+
+    std::vector<std::function<void()> > tasks;
+    for(size_t i = 0; i < pending.size(); i++){
+        const SweepJob* job = &pending[i];
+        SweepResults* shared = &results;
+        tasks.push_back([job, shared](){ runJob(*job, *shared); });
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    pool.run(tasks);
+    auto stop = std::chrono::high_resolution_clock::now();
+
+    printf("\nSweep finished in %lld ms: %zu jobs run, %lld failed, %lld steals\n",
+        (ll)std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count(),
+        pending.size(), results.getFailed(), pool.getSteals());
+}
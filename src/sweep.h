@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "config.h"
+
+#define ll long long
+
+#ifndef SWEEP_RESULTS
+#define SWEEP_RESULTS "sweep.csv"
+#endif
+
+// sweep 명세 (--sweep <spec>)
+//   trace <path>|gen:<spec>                 모든 설정을 돌릴 트레이스 (여러 줄 가능)
+//   level <policy> <cacheSize> <blockSize> <setAssociativity> [key=value ...]
+//                                           레벨 하나 (위에서부터 L1, L2, ...)
+// 레벨 줄의 각 값은 쉼표로 여러 개(lru,srrip), a..b 로 a부터 b까지 두 배씩(8K..64K) 줄 수 있고,
+// 모든 조합(트레이스 x 레벨별 후보의 곱)이 작업 하나씩이 됨. # 뒤는 주석.
+struct SweepJob {
+    std::string trace;
+    std::vector<LevelConfig> config;
+    std::string description; // 레벨 설정을 "; "로 이은 것 (결과 파일에서 작업의 키)
+    ll cost;                 // 스케줄링용 추정 비용
+};
+
+// 명세를 작업 목록으로 펼침 (cacheSize가 blockSize*setAssociativity로 나누어지지 않거나
+// 정책, 인덱스 함수, 플러그인을 찾을 수 없는 조합은 건너뜀)
+std::vector<SweepJob> expandSweep(const char* specPath, ll& skipped);
+
+// 결과 파일에 아직 없는 작업을 threads 개의 스레드로 실행하고 레벨별 한 줄씩 덧붙임
+//   trace,config,level,policy,accesses,hits,misses,hitRate,memoryAccesses,durationMs
+void runSweep(const char* specPath, const char* resultsPath, int threads);
@@ -0,0 +1,78 @@
+#include "threadPool.h"
+#include <thread>
+
+#define ll long long
+
+WorkStealingPool::WorkStealingPool(int threads){
+    if(threads <= 0){
+        threads = std::thread::hardware_concurrency();
+        if(threads <= 0) threads = 1;
+    }
+    this->threads = threads;
+    this->steals = 0;
+    for(int worker = 0; worker < threads; worker++){
+        queues.push_back(new Queue());
+    }
+}
+
+bool WorkStealingPool::pop(int worker, std::function<void()>& task){
+    std::lock_guard<std::mutex> guard(queues[worker]->lock);
+    if(queues[worker]->tasks.empty()){
+        return false;
+    }
+    task = queues[worker]->tasks.front();
+    queues[worker]->tasks.pop_front();
+    return true;
+}
+
+bool WorkStealingPool::steal(int worker, std::function<void()>& task){
+    for(int offset = 1; offset < threads; offset++){
+        Queue* victim = queues[(worker + offset) % threads];
+        std::lock_guard<std::mutex> guard(victim->lock);
+        if(!victim->tasks.empty()){
+            task = victim->tasks.back();
+            victim->tasks.pop_back();
+            std::lock_guard<std::mutex> count(stealLock);
+            steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 작업이 실행 중에 추가되지 않으므로 모든 큐가 비면 끝
+void WorkStealingPool::work(int worker){
+    std::function<void()> task;
+    while(pop(worker, task) || steal(worker, task)){
+        task();
+    }
+}
+
+void WorkStealingPool::run(const std::vector<std::function<void()> >& tasks){
+    for(size_t i = 0; i < tasks.size(); i++){
+        queues[i % threads]->tasks.push_back(tasks[i]);
+    }
+
+    std::vector<std::thread> workers;
+    for(int worker = 1; worker < threads; worker++){
+        workers.push_back(std::thread(&WorkStealingPool::work, this, worker));
+    }
+    work(0);
+    for(size_t i = 0; i < workers.size(); i++){
+        workers[i].join();
+    }
+}
+
+int WorkStealingPool::getThreads(){
+    return threads;
+}
+
+ll WorkStealingPool::getSteals(){
+    return steals;
+}
+
+WorkStealingPool::~WorkStealingPool(){
+    for(int worker = 0; worker < threads; worker++){
+        delete queues[worker];
+    }
+}
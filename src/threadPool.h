@@ -0,0 +1,42 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#define ll long long
+
+// 작업 훔치기(work-stealing) 스레드 풀
+// 작업은 시작할 때 스레드별 큐에 번갈아 배분됨. 각 스레드는 자기 큐의 앞에서 꺼내고,
+// 큐가 비면 다른 스레드 큐의 뒤에서 훔쳐 옴. 긴 트레이스가 한 스레드에 몰려도 코어가 놀지 않음.
+// 작업은 시뮬레이션 한 번 단위로 굵으므로 큐마다 mutex 하나면 충분함.
+class WorkStealingPool{
+
+    private:
+        struct Queue {
+            std::mutex lock;
+            std::deque<std::function<void()> > tasks;
+        };
+
+        int threads;
+        std::vector<Queue*> queues;
+        ll steals;
+        std::mutex stealLock;
+
+        bool pop(int worker, std::function<void()>& task);
+        bool steal(int worker, std::function<void()>& task);
+        void work(int worker);
+
+    public:
+        // threads <= 0 이면 하드웨어 스레드 수
+        WorkStealingPool(int threads);
+
+        // 모든 작업이 끝날 때까지 실행 (오래 걸리는 작업을 앞에 두면 먼저 시작됨)
+        void run(const std::vector<std::function<void()> >& tasks);
+
+        int getThreads();
+        ll getSteals();
+
+        ~WorkStealingPool();
+};
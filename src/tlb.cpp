@@ -0,0 +1,147 @@
+#include "tlb.h"
+#include "config.h"
+#include "policyRegistry.h"
+#include <sstream>
+#include <stdexcept>
+
+#define ll long long
+
+// 4단계 페이지 테이블: 깊이마다 가상 주소 9비트 (PML4 39~47, PDPT 30~38, PD 21~29, PT 12~20)
+#define VIRTUAL_BITS 48
+#define TABLE_BITS 9
+#define TABLE_SIZE 4096
+#define ENTRY_SIZE 8
+
+TLB::TLB(const std::string& spec){
+    pageSize = 4096;
+    ll entries[2] = {64, 1536};
+    ll ways[2] = {4, 12};
+    std::string policy = "lru";
+    nextTable = 0x7f0000000000LL;
+    walks = 0;
+    walkReferences = 0;
+
+    std::istringstream fields(spec);
+    std::string option;
+    while(std::getline(fields, option, ',')){
+        if(option.empty()) continue;
+        size_t split = option.find('=');
+        if(split == std::string::npos){
+            throw std::invalid_argument("Invalid TLB option: " + option + " (expected key=value)");
+        }
+        std::string key = option.substr(0, split), value = option.substr(split+1);
+        if(key == "page") pageSize = parseSize(key, value);
+        else if(key == "l1") entries[0] = parseSize(key, value);
+        else if(key == "l1ways") ways[0] = parseSize(key, value);
+        else if(key == "l2") entries[1] = parseSize(key, value);
+        else if(key == "l2ways") ways[1] = parseSize(key, value);
+        else if(key == "policy") policy = value;
+        else if(key == "ptbase") nextTable = parseSize(key, value);
+        else {
+            throw std::invalid_argument("Unknown TLB option: " + key);
+        }
+    }
+
+    // 4K: PT 까지, 2M: PD 항목이 페이지, 1G: PDPT 항목이 페이지
+    if(pageSize == 4096) walkLength = 4;
+    else if(pageSize == 2LL<<20) walkLength = 3;
+    else if(pageSize == 1LL<<30) walkLength = 2;
+    else {
+        throw std::invalid_argument("Invalid TLB page size: " + std::to_string(pageSize) + " (expected 4K, 2M or 1G)");
+    }
+    if(policy == "upgradedLRU"){
+        throw std::invalid_argument("upgradedLRU keeps its own sectored tags and cannot be used for a TLB");
+    }
+
+    for(int level = 0; level < 2; level++){
+        if(level > 0 && entries[level] == 0) break;
+        if(entries[level] <= 0 || ways[level] <= 0 || entries[level] % ways[level] != 0){
+            throw std::invalid_argument("Invalid L" + std::to_string(level + 1) + " TLB: " + std::to_string(entries[level])
+                + " entries, " + std::to_string(ways[level]) + " ways");
+        }
+        Cache* tlb = createPolicy(policy, entries[level] * pageSize, pageSize, ways[level], level + 1, true);
+        if(tlb == NULL){
+            throw std::invalid_argument("Unknown TLB policy: " + policy);
+        }
+        // 세트 수가 2의 거듭제곱이 아니면 나머지로 인덱스
+        ll sets = entries[level] / ways[level];
+        if(sets & (sets - 1)) tlb->setIndexFunction(INDEX_MODULO);
+        levels.push_back(tlb);
+    }
+}
+
+bool TLB::lookup(Cache* tlb, ll address){
+    ll block = tlb->getBlockPosition(address);
+    if(block != -1){
+        tlb->incHits();
+        tlb->update(block, 1);
+        return true;
+    }
+    tlb->incMisses();
+    ll blockToReplace = tlb->getBlockToReplace(address);
+    tlb->insert(Access{'l', address}, blockToReplace);
+    tlb->update(blockToReplace, 0);
+    return false;
+}
+
+int TLB::translate(ll address, Access* walk){
+    // 미스난 TLB는 모두 채워짐
+    for(size_t level = 0; level < levels.size(); level++){
+        if(lookup(levels[level], address)) return 0;
+    }
+
+    walks++;
+    unsigned long long virtualAddress = (unsigned long long)address & ((1ULL << VIRTUAL_BITS) - 1);
+    for(int depth = 0; depth < walkLength; depth++){
+        // 이 깊이의 노드는 그 위 깊이들의 인덱스 비트로 정해짐
+        int shift = VIRTUAL_BITS - TABLE_BITS * (depth + 1);
+        ll prefix = depth == 0 ? 0 : (ll)(virtualAddress >> (shift + TABLE_BITS));
+        std::pair<std::unordered_map<ll, ll>::iterator, bool> table = tables.insert(std::make_pair(prefix * TLB_MAX_WALK + depth, nextTable));
+        if(table.second) nextTable += TABLE_SIZE;
+        ll index = (virtualAddress >> shift) & ((1 << TABLE_BITS) - 1);
+        walk[depth] = {'l', table.first->second + index * ENTRY_SIZE};
+    }
+    walkReferences += walkLength;
+    return walkLength;
+}
+
+void TLB::recordWalk(int hitLevel){
+    if((int)walkMisses.size() < hitLevel) walkMisses.resize(hitLevel, 0);
+    for(int level = 0; level < hitLevel; level++){
+        walkMisses[level]++;
+    }
+}
+
+int TLB::getLevels(){
+    return levels.size();
+}
+
+Cache* TLB::getCache(int level){
+    return levels[level];
+}
+
+ll TLB::getPageSize(){
+    return pageSize;
+}
+
+int TLB::getWalkLength(){
+    return walkLength;
+}
+
+ll TLB::getWalks(){
+    return walks;
+}
+
+ll TLB::getWalkReferences(){
+    return walkReferences;
+}
+
+ll TLB::getWalkMisses(int level){
+    return level >= 0 && level < (int)walkMisses.size() ? walkMisses[level] : 0;
+}
+
+TLB::~TLB(){
+    for(size_t level = 0; level < levels.size(); level++){
+        delete levels[level];
+    }
+}
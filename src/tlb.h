@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "cache.h"
+
+#define ll long long
+
+// 주소 변환 (--tlb <spec>)
+// 트레이스 주소를 가상 주소로 보고 L1/L2 TLB로 변환함. 두 TLB 모두 미스면 x86-64 4단계 페이지 테이블을
+// 걷는 메모리 참조를 만들고, 호출한 쪽이 그 참조를 데이터 접근보다 먼저 캐시 계층에 넣음.
+// TLB는 페이지 크기를 블록 크기로 하는 Cache이므로 교체 정책은 params.cfg 의 정책을 그대로 씀.
+// 데이터 주소는 바꾸지 않음 (항등 매핑). 페이지 테이블은 ptbase 부터 처음 쓰일 때 차례로 놓임.
+//
+// spec: key=value[,key=value...]
+//   page=<bytes>        페이지 크기 4K, 2M 또는 1G (기본 4K). walk 참조는 각각 4, 3, 2 번
+//   l1=<entries>        L1 TLB 항목 수 (기본 64)
+//   l1ways=<ways>       L1 TLB 연관도 (기본 4)
+//   l2=<entries>        L2 TLB 항목 수 (기본 1536, 0 이면 L2 TLB 없음)
+//   l2ways=<ways>       L2 TLB 연관도 (기본 12)
+//   policy=<name>       두 TLB의 교체 정책 (기본 lru)
+//   ptbase=<address>    페이지 테이블의 시작 물리 주소 (기본 0x7f0000000000)
+
+#define TLB_MAX_WALK 4
+
+class TLB{
+
+    private:
+        std::vector<Cache*> levels; // L1, L2 TLB
+        ll pageSize;
+        int walkLength;
+        ll nextTable;                         // 다음 페이지 테이블 노드의 물리 주소
+        std::unordered_map<ll, ll> tables;    // (상위 주소 비트, 깊이) -> 노드의 물리 주소
+        ll walks, walkReferences;
+        std::vector<ll> walkMisses;           // 캐시 레벨별로 walk 참조가 미스난 횟수
+
+        bool lookup(Cache* tlb, ll address);
+
+    public:
+        // spec 이 잘못되면 std::invalid_argument
+        TLB(const std::string& spec);
+
+        // address 를 변환. TLB 미스면 walk 참조를 walk 에 채우고 그 수를 반환 (히트면 0)
+        int translate(ll address, Access* walk);
+        // walk 참조 하나가 캐시 계층의 hitLevel 에서 히트함 (모든 레벨에서 미스면 레벨 수)
+        void recordWalk(int hitLevel);
+
+        int getLevels();
+        Cache* getCache(int level);
+        ll getPageSize();
+        int getWalkLength();
+        ll getWalks();
+        ll getWalkReferences();
+        // 캐시 level (0 = L1) 에서 미스난 walk 참조 수
+        ll getWalkMisses(int level);
+
+        ~TLB();
+};
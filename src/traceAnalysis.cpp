@@ -0,0 +1,187 @@
+#include "traceAnalysis.h"
+#include <algorithm>
+#include <math.h>
+#include <stdexcept>
+
+#define ll long long
+
+// splitmix64 최종 단계: 주소의 모든 비트를 섞어 HyperLogLog에 넣음
+static inline unsigned long long hashLine(ll line){
+    unsigned long long z = (unsigned long long)line + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+HyperLogLog::HyperLogLog(int precision){
+    this->precision = precision;
+    registers.assign(1 << precision, 0);
+}
+
+double HyperLogLog::estimate(){
+    double m = registers.size();
+    double sum = 0;
+    ll zeros = 0;
+    for(size_t i = 0; i < registers.size(); i++){
+        sum += ldexp(1.0, -registers[i]);
+        if(registers[i] == 0) zeros++;
+    }
+    double estimate = 0.7213 / (1 + 1.079 / m) * m * m / sum;
+    // 원소가 적을 때는 linear counting이 더 정확함
+    if(estimate <= 2.5 * m && zeros > 0){
+        estimate = m * log(m / zeros);
+    }
+    return estimate;
+}
+
+void HyperLogLog::clear(){
+    std::fill(registers.begin(), registers.end(), 0);
+}
+
+TraceAnalyzer::TraceAnalyzer(ll lineSize, ll window, bool exact)
+    : footprintSketch(14), windowSketch(12){
+    if(lineSize <= 0 || (lineSize & (lineSize - 1)) != 0 || window <= 0){
+        throw std::invalid_argument("Invalid analysis parameters: line " + std::to_string(lineSize) + ", window "
+            + std::to_string(window));
+    }
+    this->lineSize = lineSize;
+    this->lineBits = log2(lineSize);
+    this->window = window;
+    this->exact = exact;
+    this->reads = 0;
+    this->writes = 0;
+    this->accesses = 0;
+    this->previousLine = -1;
+    this->windowLeft = window;
+    this->zeroStrides = 0;
+    memset(positiveStrides, 0, sizeof(positiveStrides));
+    memset(negativeStrides, 0, sizeof(negativeStrides));
+}
+
+void TraceAnalyzer::record(const Access& access){
+    ll line = access.address >> lineBits;
+    accesses++;
+    if(access.accessType == 's') writes++;
+    else reads++;
+
+    if(exact){
+        footprintSet.insert(line);
+        windowSet.insert(line);
+    } else {
+        unsigned long long hash = hashLine(line);
+        footprintSketch.add(hash);
+        windowSketch.add(hash);
+    }
+
+    // 직전 접근과의 라인 단위 거리
+    if(previousLine != -1){
+        ll stride = line - previousLine;
+        if(stride == 0){
+            zeroStrides++;
+        } else {
+            int bucket = 63 - __builtin_clzll(stride > 0 ? stride : -stride);
+            if(bucket >= STRIDE_BUCKETS) bucket = STRIDE_BUCKETS - 1;
+            (stride > 0 ? positiveStrides : negativeStrides)[bucket]++;
+        }
+    }
+    previousLine = line;
+
+    if(--windowLeft == 0){
+        closeWindow();
+    }
+}
+
+ll TraceAnalyzer::footprint(){
+    return exact ? footprintSet.size() : llround(footprintSketch.estimate());
+}
+
+void TraceAnalyzer::closeWindow(){
+    if(exact){
+        workingSets.push_back(windowSet.size());
+        windowSet.clear();
+    } else {
+        workingSets.push_back(llround(windowSketch.estimate()));
+        windowSketch.clear();
+    }
+    footprints.push_back(footprint());
+    windowLeft = window;
+}
+
+void TraceAnalyzer::finish(){
+    if(windowLeft != window){
+        closeWindow();
+    }
+}
+
+static void printBytes(const char* label, ll lines, ll lineSize){
+    double bytes = (double)lines * lineSize;
+    const char* unit = "B";
+    if(bytes >= (1LL << 30)) { bytes /= (1LL << 30); unit = "GB"; }
+    else if(bytes >= (1 << 20)) { bytes /= (1 << 20); unit = "MB"; }
+    else if(bytes >= (1 << 10)) { bytes /= (1 << 10); unit = "KB"; }
+    printf("%-28s: %lld lines (%.1f %s)\n", label, lines, bytes, unit);
+}
+
+void TraceAnalyzer::report(){
+    printf("\n");
+    printf("Total Number Of Instructions: %lld\n", accesses);
+    printf("Number of Reads             : %lld\n", reads);
+    printf("Number of Writes            : %lld\n", writes);
+    printf("Read/Write Ratio            : %f\n", writes == 0 ? 0.0 : (double)reads/writes);
+    printf("\n");
+
+    printf("Footprint (%s, %lld B lines)\n", exact ? "exact" : "HyperLogLog, ~1%", lineSize);
+    printBytes("Unique lines", footprint(), lineSize);
+    if(!workingSets.empty()){
+        std::vector<ll> sorted(workingSets);
+        std::sort(sorted.begin(), sorted.end());
+        printf("Working set per %lld accesses (%zu windows)\n", window, sorted.size());
+        printBytes("  median", sorted[sorted.size()/2], lineSize);
+        printBytes("  90th percentile", sorted[sorted.size()*9/10], lineSize);
+        printBytes("  max", sorted.back(), lineSize);
+
+        // 누적 footprint를 10개 시점에서만 출력 (전체 구간은 --analysis-csv 로)
+        printf("Footprint over time\n");
+        size_t points = std::min((size_t)10, footprints.size());
+        for(size_t point = 1; point <= points; point++){
+            size_t i = footprints.size() * point / points - 1;
+            char label[64];
+            snprintf(label, sizeof(label), "  after %lld accesses", std::min(accesses, (ll)(i + 1) * window));
+            printBytes(label, footprints[i], lineSize);
+        }
+    }
+    printf("\n");
+
+    // 0과 부호별 log2 버킷, 비어 있는 버킷은 생략
+    ll strides = accesses > 0 ? accesses - 1 : 0;
+    printf("Stride histogram (lines between consecutive accesses)\n");
+    char label[64];
+    for(int bucket = STRIDE_BUCKETS - 1; bucket >= 0; bucket--){
+        if(negativeStrides[bucket] == 0) continue;
+        snprintf(label, sizeof(label), "-[%lld, %lld)", 1LL << bucket, 2LL << bucket);
+        printf("  %-26s %14lld %6.2f%%\n", label, negativeStrides[bucket], 100.0*negativeStrides[bucket]/strides);
+    }
+    if(zeroStrides > 0){
+        printf("  %-26s %14lld %6.2f%%\n", "0", zeroStrides, 100.0*zeroStrides/strides);
+    }
+    for(int bucket = 0; bucket < STRIDE_BUCKETS; bucket++){
+        if(positiveStrides[bucket] == 0) continue;
+        snprintf(label, sizeof(label), "+[%lld, %lld)", 1LL << bucket, 2LL << bucket);
+        printf("  %-26s %14lld %6.2f%%\n", label, positiveStrides[bucket], 100.0*positiveStrides[bucket]/strides);
+    }
+    printf("\n");
+}
+
+void TraceAnalyzer::writeWindowsCsv(const char* path){
+    FILE* out = fopen(path, "w");
+    if(out == NULL){
+        printf("Failed to open %s for writing\n", path);
+        return;
+    }
+    fprintf(out, "interval,accesses,workingSetLines,workingSetBytes,footprintLines,footprintBytes\n");
+    for(size_t i = 0; i < workingSets.size(); i++){
+        fprintf(out, "%zu,%lld,%lld,%lld,%lld,%lld\n", i, std::min(accesses, (ll)(i + 1) * window),
+            workingSets[i], workingSets[i] * lineSize, footprints[i], footprints[i] * lineSize);
+    }
+    fclose(out);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "cache.h"
+
+#define ll long long
+
+// 접근 스트림 분석 (--analyze)
+// 트레이스를 한 번 읽으면서 시뮬레이션 없이 트레이스의 특성만 측정함.
+
+#ifndef ANALYSIS_WINDOW
+#define ANALYSIS_WINDOW 100000
+#endif
+
+// 스트라이드 히스토그램 버킷: 0, 그리고 부호별로 [2^i, 2^(i+1)) 라인
+#define STRIDE_BUCKETS 40
+
+// 서로 다른 원소 수를 고정 메모리로 추정하는 HyperLogLog (2^precision 바이트, 표준 오차 1.04/sqrt(2^precision))
+class HyperLogLog{
+
+    private:
+        int precision;
+        std::vector<unsigned char> registers;
+
+    public:
+        HyperLogLog(int precision);
+
+        inline void add(unsigned long long hash){
+            unsigned long long index = hash >> (64 - precision);
+            // 나머지 비트의 앞쪽 0의 개수 + 1 (모두 0이어도 64-precision+1 에서 멈춤)
+            unsigned long long rest = (hash << precision) | (1ULL << (precision - 1));
+            unsigned char rank = __builtin_clzll(rest) + 1;
+            if(rank > registers[index]) registers[index] = rank;
+        }
+        double estimate();
+        void clear();
+};
+
+class TraceAnalyzer{
+
+    private:
+        ll lineSize;
+        int lineBits;
+        ll window;
+        bool exact; // 해시 집합으로 정확히 셀지, HyperLogLog로 추정할지
+
+        ll reads, writes;
+        ll accesses;
+        ll previousLine;
+
+        // 전체 footprint
+        HyperLogLog footprintSketch;
+        std::unordered_set<ll> footprintSet;
+
+        // 현재 구간의 working set
+        HyperLogLog windowSketch;
+        std::unordered_set<ll> windowSet;
+        ll windowLeft;
+        std::vector<ll> workingSets;  // 구간별 서로 다른 라인 수
+        std::vector<ll> footprints;   // 구간이 끝날 때까지의 누적 footprint (라인)
+
+        ll positiveStrides[STRIDE_BUCKETS];
+        ll negativeStrides[STRIDE_BUCKETS];
+        ll zeroStrides;
+
+        ll footprint();
+        void closeWindow();
+
+    public:
+        // lineSize: footprint와 스트라이드를 셀 단위 (바이트, 2의 거듭제곱), window: 구간 길이 (접근)
+        TraceAnalyzer(ll lineSize, ll window, bool exact);
+
+        void record(const Access& access);
+        // 마지막으로 채워지지 않은 구간도 기록
+        void finish();
+
+        void report();
+        // interval,accesses,workingSetLines,workingSetBytes,footprintLines,footprintBytes
+        void writeWindowsCsv(const char* path);
+};
@@ -0,0 +1,175 @@
+#include "traceGen.h"
+#include "config.h"
+#include <math.h>
+#include <sstream>
+#include <stdexcept>
+
+#define ll long long
+
+static ll gcd(ll a, ll b){
+    while(b){
+        ll t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+TraceGenerator::TraceGenerator(const std::string& spec){
+    count = 1000000;
+    generated = 0;
+    footprint = 64LL<<20;
+    base = 0x10000000;
+    stride = -1;
+    line = 64;
+    alpha = 0.99;
+    writeRatio = 0.3;
+    ll seed = 1;
+
+    std::istringstream fields(spec);
+    std::string name, option;
+    std::getline(fields, name, ',');
+    if(name == "seq" || name == "stride"){
+        pattern = GEN_SEQ;
+    } else if(name == "uniform"){
+        pattern = GEN_UNIFORM;
+    } else if(name == "zipf"){
+        pattern = GEN_ZIPF;
+    } else if(name == "chase"){
+        pattern = GEN_CHASE;
+    } else {
+        throw std::invalid_argument("Unknown trace pattern: " + name + " (expected seq, stride, uniform, zipf or chase)");
+    }
+
+    while(std::getline(fields, option, ',')){
+        size_t split = option.find('=');
+        if(split == std::string::npos){
+            throw std::invalid_argument("Invalid generator option: " + option + " (expected key=value)");
+        }
+        std::string key = option.substr(0, split), value = option.substr(split+1);
+        if(key == "count") count = parseSize(key, value);
+        else if(key == "footprint") footprint = parseSize(key, value);
+        else if(key == "base") base = parseSize(key, value);
+        else if(key == "stride") stride = parseSize(key, value);
+        else if(key == "line") line = parseSize(key, value);
+        else if(key == "seed") seed = parseSize(key, value);
+        else if(key == "alpha") alpha = atof(value.c_str());
+        else if(key == "write") writeRatio = atof(value.c_str());
+        else {
+            throw std::invalid_argument("Unknown generator option: " + key);
+        }
+    }
+    if(stride < 0){
+        stride = name == "stride" ? 4096 : 8;
+    }
+    if(footprint <= 0 || line <= 0 || stride <= 0 || alpha <= 0){
+        throw std::invalid_argument("Invalid generator parameters: " + spec);
+    }
+
+    state = seed;
+    position = 0;
+    lines = footprint / line > 0 ? footprint / line : 1;
+
+    chaseModulus = 1;
+    while(chaseModulus < lines) chaseModulus <<= 1;
+    if(pattern == GEN_CHASE){
+        position = nextRandom() % lines;
+    }
+
+    scatter = 1000003;
+    while(gcd(scatter, lines) != 1) scatter += 2;
+
+    hIntegralX1 = hIntegral(1.5) - 1;
+    hIntegralN = hIntegral(lines + 0.5);
+    s = 2 - hIntegralInverse(hIntegral(2.5) - h(2));
+}
+
+// splitmix64
+unsigned long long TraceGenerator::nextRandom(){
+    unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+double TraceGenerator::nextUniform(){
+    return (nextRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Hörmann & Derflinger, "Rejection-inversion to generate variates from monotone discrete distributions"
+// 테이블 없이 O(1)에 1..lines 사이의 순위를 뽑음
+static double helper1(double x){
+    return fabs(x) > 1e-8 ? log1p(x) / x : 1 - x * (0.5 - x * (1.0/3 - 0.25 * x));
+}
+
+static double helper2(double x){
+    return fabs(x) > 1e-8 ? expm1(x) / x : 1 + x * 0.5 * (1 + x * (1.0/3) * (1 + 0.25 * x));
+}
+
+double TraceGenerator::h(double x){
+    return exp(-alpha * log(x));
+}
+
+double TraceGenerator::hIntegral(double x){
+    double logX = log(x);
+    return helper2((1 - alpha) * logX) * logX;
+}
+
+double TraceGenerator::hIntegralInverse(double x){
+    double t = x * (1 - alpha);
+    if(t < -1) t = -1;
+    return exp(helper1(t) * x);
+}
+
+ll TraceGenerator::nextZipfRank(){
+    while(true){
+        double u = hIntegralN + nextUniform() * (hIntegralX1 - hIntegralN);
+        double x = hIntegralInverse(u);
+        ll k = (ll)(x + 0.5);
+        if(k < 1) k = 1;
+        else if(k > lines) k = lines;
+        if(k - x <= s || u >= hIntegral(k + 0.5) - h(k)){
+            return k;
+        }
+    }
+}
+
+Access TraceGenerator::next(){
+    if(generated >= count){
+        return {-1, 0};
+    }
+    generated++;
+
+    ll address;
+    switch(pattern){
+        case GEN_SEQ:
+            address = base + position;
+            position += stride;
+            if(position >= footprint) position = 0;
+            break;
+        case GEN_UNIFORM:
+            address = base + (ll)(nextRandom() % (footprint / 8 > 0 ? footprint / 8 : 1)) * 8;
+            break;
+        case GEN_ZIPF:
+            address = base + ((nextZipfRank() - 1) * scatter % lines) * line;
+            break;
+        default: // GEN_CHASE: 2의 거듭제곱 법의 full-period LCG를 lines 안으로 cycle walking
+            do {
+                position = (ll)((6364136223846793005ULL * (unsigned long long)position + 1442695040888963407ULL)
+                    & (unsigned long long)(chaseModulus - 1));
+            } while(position >= lines);
+            address = base + position * line;
+            break;
+    }
+
+    char accessType = nextUniform() < writeRatio ? 's' : 'l';
+    return {accessType, address};
+}
+
+ll TraceGenerator::getCount(){
+    return count;
+}
+
+ll TraceGenerator::getGenerated(){
+    return generated;
+}
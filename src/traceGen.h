@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+#include "cache.h"
+
+#define ll long long
+
+// 합성 트레이스 생성기
+// 파일을 거치지 않고 Access를 바로 시뮬레이터에 넣음. 같은 spec과 seed면 항상 같은 트레이스를 만듦.
+//
+// spec: <pattern>[,key=value...]
+//   seq      base 부터 stride (기본 8) 바이트씩 순차 접근, footprint 끝에서 처음으로
+//   stride   seq 와 같지만 stride 기본값이 4096
+//   uniform  footprint 안의 임의 워드
+//   zipf     footprint 안의 라인을 Zipf(alpha) 분포로 선택 (순위는 라인 전체에 흩어짐)
+//   chase    footprint 안의 모든 라인을 한 번씩 도는 임의 순서 (pointer chase)
+//
+//   count=<accesses>    생성할 접근 수 (기본 1000000)
+//   footprint=<bytes>   접근 범위 (기본 64M, K/M/G 접미사 가능)
+//   base=<address>      시작 주소 (기본 0x10000000)
+//   stride=<bytes>      seq/stride 간격
+//   line=<bytes>        zipf/chase의 라인 크기 (기본 64)
+//   alpha=<exponent>    zipf 지수 (기본 0.99)
+//   write=<ratio>       쓰기 비율 0..1 (기본 0.3)
+//   seed=<n>            난수 시드 (기본 1)
+class TraceGenerator{
+
+    private:
+        enum Pattern { GEN_SEQ, GEN_UNIFORM, GEN_ZIPF, GEN_CHASE };
+
+        Pattern pattern;
+        ll count, generated;
+        ll footprint, base, stride, line;
+        double alpha, writeRatio;
+        unsigned long long state; // splitmix64 상태
+
+        ll position;     // seq: 현재 오프셋, chase: 현재 라인
+        ll lines;        // footprint 안의 라인 수
+        ll chaseModulus; // lines 이상인 가장 작은 2의 거듭제곱
+        ll scatter;      // zipf 순위를 라인으로 흩는 곱 (lines와 서로소)
+
+        // rejection-inversion Zipf 샘플링 상수
+        double hIntegralX1, hIntegralN, s;
+
+        unsigned long long nextRandom();
+        double nextUniform();
+        ll nextZipfRank();
+        double hIntegral(double x);
+        double hIntegralInverse(double x);
+        double h(double x);
+
+    public:
+        // spec 이 잘못되면 std::invalid_argument
+        TraceGenerator(const std::string& spec);
+
+        // 다음 접근 (끝나면 accessType == -1)
+        Access next();
+        ll getCount();
+        ll getGenerated();
+};
@@ -0,0 +1,95 @@
+#include "traceReader.h"
+#include <stdexcept>
+#include <string.h>
+
+#define ll long long
+
+#define GENERATOR_PREFIX "gen:"
+
+TraceReader::TraceReader(const std::string& path){
+    this->path = path;
+    text = NULL;
+    file = NULL;
+    compact = NULL;
+    generator = NULL;
+    line = 0;
+    size = 0;
+
+    if(path.compare(0, strlen(GENERATOR_PREFIX), GENERATOR_PREFIX) == 0){
+        generator = new TraceGenerator(path.substr(strlen(GENERATOR_PREFIX)));
+        return;
+    }
+
+    file = fopen(path.c_str(), "rb");
+    if(file == NULL){
+        throw std::invalid_argument("Failed to open trace " + path);
+    }
+    if(isCompactTrace(file)){
+        compact = new CompactTraceReader(file);
+        return;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fclose(file);
+    file = NULL;
+
+    // gzopen은 gzip이 아닌 파일도 그대로 읽음
+    text = gzopen(path.c_str(), "rb");
+    if(text == NULL){
+        throw std::invalid_argument("Failed to open trace " + path);
+    }
+    gzbuffer(text, 1 << 17);
+}
+
+Access TraceReader::next(){
+    if(generator != NULL) return generator->next();
+    if(compact != NULL) return compact->next();
+
+    char buffer[256];
+    while(gzgets(text, buffer, sizeof(buffer)) != NULL){
+        line++;
+        char accessType;
+        char address[20];
+        int result = sscanf(buffer, " %c %19s", &accessType, address);
+        if(result == EOF) continue; // 빈 줄
+        if(result != 2 || (accessType != 'l' && accessType != 's')){
+            throw std::invalid_argument("Invalid input format in " + path + " line " + std::to_string(line));
+        }
+        return {accessType, hexToDec(address)};
+    }
+    return {-1, 0};
+}
+
+double TraceReader::getProgress(){
+    if(generator != NULL) return generator->getCount() > 0 ? (double)generator->getGenerated()/generator->getCount() : 1.0;
+    if(compact != NULL) return compact->getProgress();
+    // gzoffset은 압축된 파일에서의 위치
+    return size > 0 ? (double)gzoffset(text)/size : 1.0;
+}
+
+const std::string& TraceReader::getPath(){
+    return path;
+}
+
+CompactTraceReader* TraceReader::getCompactReader(){
+    return compact;
+}
+
+TraceReader::~TraceReader(){
+    delete generator;
+    delete compact;
+    if(file != NULL) fclose(file);
+    if(text != NULL) gzclose(text);
+}
+
+bool isReadableTrace(const std::string& path){
+    if(path.compare(0, strlen(GENERATOR_PREFIX), GENERATOR_PREFIX) == 0){
+        return true;
+    }
+    FILE* file = fopen(path.c_str(), "rb");
+    if(file == NULL){
+        return false;
+    }
+    fclose(file);
+    return true;
+}
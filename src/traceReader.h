@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <zlib.h>
+#include "cache.h"
+#include "compactTrace.h"
+#include "traceGen.h"
+
+#define ll long long
+
+// 경로로 연 트레이스 (stdin 대신 파일에서 읽어야 하는 sweep 등에서 사용)
+//   gen:<spec>      합성 트레이스 (-g 와 같은 spec)
+//   compact 트레이스 (-f 로 만든 미스 스트림)
+//   그 밖의 파일    gzip 또는 일반 텍스트 Pin 트레이스 ("l 0x1fffff50" 형식의 줄)
+class TraceReader{
+
+    private:
+        std::string path;
+        gzFile text;
+        FILE* file;
+        CompactTraceReader* compact;
+        TraceGenerator* generator;
+        ll line;
+        ll size; // 텍스트 트레이스 파일의 (압축된) 크기
+
+    public:
+        // 파일을 열 수 없으면 std::invalid_argument
+        TraceReader(const std::string& path);
+
+        // 다음 접근 (끝나면 accessType == -1, 형식이 잘못되면 std::invalid_argument)
+        Access next();
+
+        // 읽은 비율 (0~1, 텍스트 트레이스는 파일 위치 기준)
+        double getProgress();
+
+        const std::string& getPath();
+        // compact 트레이스면 헤더를 읽은 reader (아니면 NULL)
+        CompactTraceReader* getCompactReader();
+
+        ~TraceReader();
+};
+
+// 트레이스를 열 수 있는지 (gen: spec은 항상 참)
+bool isReadableTrace(const std::string& path);
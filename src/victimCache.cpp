@@ -0,0 +1,62 @@
+#include "victimCache.h"
+
+#define ll long long
+
+VictimCache::VictimCache(Cache* buffer){
+    this->buffer = buffer;
+    this->hits = 0;
+    this->misses = 0;
+    this->fills = 0;
+}
+
+void VictimCache::fill(ll lineAddress, ll block){
+    buffer->writeTag(lineAddress, block); // 쫓겨난 라인은 레벨에서 옮겨 오므로 메모리 접근이 아님
+    buffer->update(block, 0);
+    fills++;
+}
+
+bool VictimCache::probe(ll address, ll evictedAddress){
+    ll block = buffer->getBlockPosition(address);
+
+    if(block != -1){ // victim hit: 찾은 라인은 레벨로 올라가고 쫓겨난 라인이 그 자리를 차지
+        hits++;
+        buffer->incHits();
+        if(evictedAddress != -1){
+            fill(evictedAddress, block);
+        } else {
+            buffer->invalidate(block);
+        }
+        return true;
+    }
+
+    misses++;
+    buffer->incMisses();
+    if(evictedAddress != -1){
+        fill(evictedAddress, buffer->getBlockToReplace(evictedAddress));
+    }
+    return false;
+}
+
+ll VictimCache::getHits(){
+    return hits;
+}
+
+ll VictimCache::getMisses(){
+    return misses;
+}
+
+ll VictimCache::getFills(){
+    return fills;
+}
+
+ll VictimCache::getEntries(){
+    return buffer->getSetAssociativity();
+}
+
+std::string VictimCache::getPolicy(){
+    return buffer->getPolicy();
+}
+
+VictimCache::~VictimCache(){
+    delete buffer;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "cache.h"
+
+#define ll long long
+
+// 레벨 뒤에 붙는 작은 fully-associative victim cache
+// 레벨에서 쫓겨난 라인을 받아 두고, 레벨 미스 시 다음 레벨보다 먼저 확인함.
+// 히트하면 찾은 라인과 방금 쫓겨난 라인을 맞바꿈 (swap).
+class VictimCache{
+
+    private:
+        Cache* buffer; // 세트가 하나인 캐시 (교체 정책은 기존 정책 클래스 사용)
+        ll hits, misses;
+        ll fills; // 쫓겨난 라인이 들어온 횟수
+
+        void fill(ll lineAddress, ll block);
+
+    public:
+        VictimCache(Cache* buffer);
+
+        // address 를 찾고 evictedAddress (레벨에서 방금 쫓겨난 라인, 없으면 -1)를 저장
+        // address 가 있었으면 true
+        bool probe(ll address, ll evictedAddress);
+
+        ll getHits();
+        ll getMisses();
+        ll getFills();
+        ll getEntries();
+        std::string getPolicy();
+
+        ~VictimCache();
+};
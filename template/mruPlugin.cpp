@@ -0,0 +1,41 @@
+// Example policy plugin: most recently used replacement.
+// make plugin POLICY=template/mruPlugin.cpp
+// echo -e "1\nmru 1024 64 8 plugin=template/mruPlugin.so" > mru.cfg
+
+#include "../src/policyPlugin.h"
+
+#define ll long long
+
+class MRU : public Cache{
+    private:
+        ll time;
+        ll *lastUsed;
+
+    public:
+        MRU(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) :
+            Cache(cacheSize, blockSize, setAssociativity, level, "MRU", allocateTags){
+                time = 0;
+                lastUsed = (ll*)calloc(numberOfSets*setAssociativity, sizeof(ll));
+            }
+
+        ll getBlockToReplace(ll address) override{
+            ll index = getIndex(address);
+            ll newest = index*setAssociativity;
+            for(ll block = index*setAssociativity; block < (index+1)*setAssociativity; block++){
+                if(lastUsed[block] == 0) return block; // empty frame
+                if(lastUsed[block] > lastUsed[newest]) newest = block;
+            }
+            return newest;
+        }
+
+        void update(ll block, int status) override{
+            (void)status;
+            lastUsed[block] = ++time;
+        }
+
+        ~MRU(){
+            free(lastUsed);
+        }
+};
+
+CACHESIM_POLICY_PLUGIN("mru", MRU)
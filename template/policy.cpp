@@ -2,8 +2,8 @@
 
 #define ll long long
 
-<POLICY>::<POLICY>(ll cacheSize, ll blockSize, ll setAssociativity, int level) :
-    Cache(cacheSize, blockSize, setAssociativity, level, "<POLICY>"){
+<POLICY>::<POLICY>(ll cacheSize, ll blockSize, ll setAssociativity, int level, bool allocateTags) :
+    Cache(cacheSize, blockSize, setAssociativity, level, "<POLICY>", allocateTags){
         // initialize policy specific data structure 
     }
 
@@ -17,4 +17,10 @@ void <POLICY>::update(ll block, int status){
 
 <POLICY>::~<POLICY>(){
     // free declared data structures
-}
\ No newline at end of file
+}
+
+// To build the policy as a plugin instead of adding it to policies/,
+// include "../src/policyPlugin.h" above, uncomment the line below and run
+// make plugin POLICY=<path to this file>. Load the resulting .so with
+// plugin=<path to .so> in the config (or --plugin) and use "<policy>" as the policy name.
+// CACHESIM_POLICY_PLUGIN("<policy>", <POLICY>)
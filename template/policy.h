@@ -7,7 +7,7 @@ class <POLICY> : public Cache{
         // declare policy specific data structures
 
     public:
-        <POLICY>(long long cacheSize, long long blockSize, long long setAssociativity, int level);
+        <POLICY>(long long cacheSize, long long blockSize, long long setAssociativity, int level, bool allocateTags = true);
         long long getBlockToReplace(long long address) override;
         void update(long long blockToReplace, int status) override;
 